@@ -0,0 +1,23 @@
+#ifndef DISPLAY_CONSOLE_H
+#define DISPLAY_CONSOLE_H
+
+#include <stdint.h>
+#include "display_st7789.h"
+
+// Scrolling text console on the ST7789 using hardware vertical scroll.
+// Text rows live in a RAM ring; a new line costs one VSCSAD update plus one
+// row of 5x7 glyphs. Optional fixed rows at the top stay out of the scroll.
+// Hardware scroll moves frame-memory rows, so the panel must be at rotation 0.
+
+#define CONSOLE_COLS      (ST7789_PANEL_WIDTH / 6)     // 40 characters
+#define CONSOLE_MAX_ROWS  (ST7789_PANEL_HEIGHT / 8)    // 30 rows with no fixed area
+
+void CONSOLE_Init(uint16_t top_fixed, uint16_t color, uint16_t bg);
+void CONSOLE_SetColor(uint16_t color, uint16_t bg);
+void CONSOLE_PutChar(char c);
+void CONSOLE_Write(const char *str);
+void CONSOLE_printf(const char *fmt, ...);
+void CONSOLE_Clear(void);
+void CONSOLE_Redraw(void);
+
+#endif
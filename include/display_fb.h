@@ -0,0 +1,37 @@
+#ifndef DISPLAY_FB_H
+#define DISPLAY_FB_H
+
+#include <stdint.h>
+#include "display_st7789.h"
+
+// Indexed-colour framebuffer for part of the ST7789.
+// A 4-bit or 8-bit window of the panel is drawn in RAM (one nibble or byte
+// per pixel) and only changed rows are sent. FB_Flush expands each dirty
+// row through the palette into RGB565 and streams it in one address window,
+// so a screen can be composed off-screen and shown without flicker.
+// Coordinates are relative to the framebuffer, in the current rotation.
+
+// --- Sizing ---
+#ifndef FB_BUFFER_BYTES
+#define FB_BUFFER_BYTES  9600   // e.g. 240x80 at 4 bpp, 120x80 at 8 bpp
+#endif
+
+#define FB_OK   0
+#define FB_ERR  1               // region does not fit the panel or the buffer
+
+#define FB_TRANSPARENT  0x100   // text background: leave pixels unchanged
+
+// --- Functions ---
+uint8_t FB_Init(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t bpp, const uint16_t *palette);
+void FB_SetPalette(const uint16_t *palette);
+void FB_Clear(uint8_t index);
+void FB_DrawPixel(int16_t x, int16_t y, uint8_t index);
+uint8_t FB_GetPixel(int16_t x, int16_t y);
+void FB_DrawHLine(int16_t x, int16_t y, int16_t w, uint8_t index);
+void FB_DrawVLine(int16_t x, int16_t y, int16_t h, uint8_t index);
+void FB_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t index);
+void FB_DrawString(int16_t x, int16_t y, const char *str, uint8_t index, uint16_t bg);
+void FB_Invalidate(void);
+void FB_Flush(void);
+
+#endif
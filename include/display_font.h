@@ -0,0 +1,33 @@
+#ifndef DISPLAY_FONT_H
+#define DISPLAY_FONT_H
+
+#include <stdint.h>
+#include "display_st7789.h"
+
+// Proportional fonts compiled by tools/fontconv.py (TTF/OTF or BDF).
+// Glyph boxes are trimmed to their ink and packed MSB first, bpp bits per
+// pixel: 1 = mono, 2/4 = alpha levels blended between text and background.
+
+typedef struct {
+    uint16_t offset;        // first byte in the bitmap
+    uint8_t width;          // box size (0 for missing glyphs)
+    uint8_t height;
+    int8_t xOffset;         // box left, from the pen position
+    int8_t yOffset;         // box top, from the baseline (negative = above)
+    uint8_t xAdvance;       // pen step
+} FONT_Glyph_t;
+
+typedef struct {
+    const uint8_t *bitmap;
+    const FONT_Glyph_t *glyphs;   // one entry per code in [first, last]
+    uint8_t first;
+    uint8_t last;
+    uint8_t height;               // line height
+    uint8_t baseline;             // from the top of the line
+    uint8_t bpp;                  // 1, 2 or 4
+} FONT_t;
+
+uint16_t FONT_TextWidth(const FONT_t *font, const char *str);
+void FONT_DrawString(uint16_t x, uint16_t y, const char *str, const FONT_t *font, uint16_t color, uint16_t bg);
+
+#endif
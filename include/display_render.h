@@ -0,0 +1,27 @@
+#ifndef DISPLAY_RENDER_H
+#define DISPLAY_RENDER_H
+
+#include <stdint.h>
+#include "display_st7789.h"
+
+// Band (line-buffer) renderer for the ST7789.
+// A 240x240 RGB565 frame does not fit in 20 KB of RAM, so draw calls are
+// recorded instead of sent. RENDER_Flush composes each dirty band in a small
+// RAM strip and pushes every dirty region of the band with one address window.
+// Overlapping draws (background then foreground) cost a single transfer.
+
+// --- Sizing ---
+#define RENDER_BAND_HEIGHT  8                                  // rows per strip
+#define RENDER_STRIP_PIXELS (ST7789_MAX_SIDE * RENDER_BAND_HEIGHT)  // 3840 bytes
+#define RENDER_MAX_OPS      32                                 // draw calls per frame
+#define RENDER_TEXT_POOL    256                                // bytes of string storage
+
+// --- Functions ---
+void RENDER_Begin(void);
+void RENDER_FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+void RENDER_FillScreen(uint16_t color);
+void RENDER_DrawString(uint16_t x, uint16_t y, const char *str, uint16_t color, uint16_t bg);
+void RENDER_DrawStringScaled(uint16_t x, uint16_t y, const char *str, uint16_t color, uint16_t bg, uint8_t scale);
+void RENDER_Flush(void);
+
+#endif
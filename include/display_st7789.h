@@ -9,9 +9,28 @@
 #define ST7789_RST_HIGH()  (GPIOB->BSRR = GPIO_BSRR_BS12)
 #define ST7789_RST_LOW()   (GPIOB->BSRR = GPIO_BSRR_BR12)
 
+// --- SPI clock (Hz); 0 = fastest the bus allows (fPCLK/2) ---
+#define ST7789_SPI_MAX_CLOCK  0
+
 // --- Display Dimensions ---
-#define ST7789_WIDTH   240
-#define ST7789_HEIGHT  240
+#define ST7789_PANEL_WIDTH   240  // native size (rotation 0)
+#define ST7789_PANEL_HEIGHT  240
+#define ST7789_MAX_SIDE      240  // longest side, for line buffers
+#define ST7789_MEM_HEIGHT 320  // frame memory rows (VSCRDEF areas add up to this)
+
+// Drawing size for the current rotation (updated by ST7789_SetRotation; read-only)
+extern uint16_t st7789_width;
+extern uint16_t st7789_height;
+#define ST7789_WIDTH   st7789_width
+#define ST7789_HEIGHT  st7789_height
+
+// --- Orientation (ST7789_SetRotation) ---
+#define ST7789_ROTATION_0     0
+#define ST7789_ROTATION_90    1
+#define ST7789_ROTATION_180   2
+#define ST7789_ROTATION_270   3
+#define ST7789_MIRROR_X       0x01  // flip left/right after rotating
+#define ST7789_MIRROR_Y       0x02  // flip top/bottom after rotating
 
 // --- Color Macros (RGB565) ---
 #define ST7789_COLOR_RED     0x07FF
@@ -23,15 +42,79 @@
 #define ST7789_COLOR_CYAN    0xF800  // red + green
 #define ST7789_COLOR_MAGENTA 0x07E0  // red + blue
 
+// --- RLE Image (generated by tools/img2rle.py) ---
+// Stream of 16-bit words, pixels in row-major order; runs may cross rows:
+//   1nnnnnnn nnnnnnnn, color      → n+1 copies of color
+//   0nnnnnnn nnnnnnnn, c0..cn     → n+1 literal pixels
+#define ST7789_RLE_RUN    0x8000
+#define ST7789_RLE_COUNT  0x7FFF
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    const uint16_t *data;
+    uint32_t length;        // words in data
+} ST7789_Image_t;
+
+// --- Sprite ---
+// Row-major bitmap in flash. bpp 16 = RGB565 words; bpp 1/2/4/8 = palette
+// indices packed MSB first, each row starting on a byte boundary.
+#define ST7789_SPRITE_KEYED  0x01   // pixels equal to 'key' are not drawn
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint8_t bpp;
+    uint8_t flags;
+    uint16_t key;               // RGB565 colour (bpp 16) or palette index
+    const void *pixels;
+    const uint16_t *palette;    // indexed sprites only
+} ST7789_Sprite_t;
+
+// --- Bus statistics (ST7789_GetStats) ---
+typedef struct {
+    uint32_t commands;      // command bytes (DC low)
+    uint32_t bytes;         // everything sent: commands, parameters, pixels
+    uint32_t pixels;
+} ST7789_Stats_t;
+
+// Completion callback for non-blocking operations (runs in interrupt context)
+typedef void (*ST7789_Callback_t)(void);
+
 // --- Functions ---
 void ST7789_GPIO_Init(void);
 void ST7789_Init(void);
 void ST7789_Reset(void);
+void ST7789_SetRotation(uint8_t rotation, uint8_t mirror);
+uint8_t ST7789_GetRotation(void);
+uint8_t ST7789_GetMirror(void);
+void ST7789_SetAddressWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+void ST7789_WritePixels(const uint16_t *px, uint32_t n);
+void ST7789_SetScrollArea(uint16_t tfa, uint16_t vsa, uint16_t bfa);
+void ST7789_SetScrollStart(uint16_t line);
+void ST7789_DrawImage(uint16_t x, uint16_t y, const ST7789_Image_t *img);
+void ST7789_DrawSprite(int16_t x, int16_t y, const ST7789_Sprite_t *spr);
+void ST7789_DrawHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+void ST7789_DrawVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+void ST7789_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+void ST7789_DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+void ST7789_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+void ST7789_DrawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+void ST7789_FillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+void ST7789_DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+void ST7789_FillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
 void ST7789_DrawPixel(uint16_t x, uint16_t y, uint16_t color);
 void ST7789_FillScreen(uint16_t color);
 void ST7789_FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+void ST7789_FillScreenAsync(uint16_t color, ST7789_Callback_t callback);
+void ST7789_FillRectAsync(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, ST7789_Callback_t callback);
+uint8_t ST7789_IsBusy(void);
+void ST7789_GetStats(ST7789_Stats_t *stats);
+void ST7789_ResetStats(void);
 void ST7789_DrawString(uint16_t x, uint16_t y, const char *str, uint16_t color, uint16_t bg);
 void ST7789_DrawStringScaled(uint16_t x, uint16_t y, const char *str, uint16_t color, uint16_t bg, uint8_t scale);
+void ST7789_DrawRunScaled(uint16_t x, uint16_t y, const char *str, uint16_t n, uint16_t color, uint16_t bg, uint8_t scale);
 void ST7789_DrawChar(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg);
 void ST7789_DrawCharScaled(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg, uint8_t scale);
+const uint8_t *ST7789_GetGlyph(char c);
 #endif
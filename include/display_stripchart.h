@@ -0,0 +1,61 @@
+#ifndef DISPLAY_STRIPCHART_H
+#define DISPLAY_STRIPCHART_H
+
+#include <stdint.h>
+#include "display_st7789.h"
+
+// Strip chart for live sensor plots on the ST7789.
+// Samples are kept in a ring; adding one redraws a single line of pixels
+// across the plot (background, grid and every channel's trace) with one
+// address window, so the cost per sample does not depend on the history.
+//
+//   STRIP_SWEEP   time runs left to right and wraps, like an oscilloscope.
+//                 A blank gap runs ahead of the newest sample. Any area, any
+//                 rotation.
+//   STRIP_SCROLL  hardware vertical scroll moves the plot; the newest sample
+//                 is always at the right (rotation 90: full-height band of
+//                 columns) or at the bottom (rotation 0: full-width band of
+//                 rows). No mirroring. Only one scrolling chart at a time,
+//                 and not together with the console.
+
+#define STRIP_MAX_CHANNELS  4
+#define STRIP_MAX_LEN       ST7789_MAX_SIDE   // samples across the time axis
+#define STRIP_SWEEP_GAP     4                 // blank columns ahead of the sweep
+
+#define STRIP_OK   0
+#define STRIP_ERR  1
+
+typedef enum {
+    STRIP_SWEEP = 0,
+    STRIP_SCROLL
+} STRIP_Mode_t;
+
+typedef struct {
+    // Set by STRIP_Init / STRIP_SetStyle / STRIP_SetRange
+    uint16_t x, y, w, h;
+    STRIP_Mode_t mode;
+    uint8_t channels;
+    int16_t min, max;                       // value range across the plot
+    uint16_t bg, grid_color;
+    uint8_t grid;                           // grid spacing in pixels, 0 = none
+    uint16_t color[STRIP_MAX_CHANNELS];
+
+    // Managed by the widget
+    uint8_t rows;                           // 1: a sample is a row, 0: a column
+    uint16_t len;                           // samples across the time axis
+    uint16_t span;                          // pixels across the value axis
+    uint16_t head;                          // ring slot of the next sample
+    uint16_t count;                         // samples on screen
+    uint32_t total;                         // samples added since clear (scroll grid)
+    int16_t samples[STRIP_MAX_LEN][STRIP_MAX_CHANNELS];
+} STRIP_t;
+
+uint8_t STRIP_Init(STRIP_t *s, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t channels, STRIP_Mode_t mode);
+void STRIP_SetStyle(STRIP_t *s, uint16_t bg, uint16_t grid_color, uint8_t grid);
+void STRIP_SetChannelColor(STRIP_t *s, uint8_t channel, uint16_t color);
+uint8_t STRIP_SetRange(STRIP_t *s, int16_t min, int16_t max);
+void STRIP_Add(STRIP_t *s, const int16_t *values);
+void STRIP_Clear(STRIP_t *s);
+void STRIP_Redraw(STRIP_t *s);
+
+#endif
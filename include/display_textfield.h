@@ -0,0 +1,28 @@
+#ifndef DISPLAY_TEXTFIELD_H
+#define DISPLAY_TEXTFIELD_H
+
+#include <stdint.h>
+#include <stdarg.h>
+#include "display_st7789.h"
+
+// Fixed-position text field that remembers what is on screen per character
+// cell and repaints only the cells whose character or colours changed.
+// Changed neighbours are grouped so each run costs one address window.
+
+#define TEXTFIELD_MAX_CHARS 40
+
+typedef struct {
+    uint16_t x, y;
+    uint8_t scale;
+    uint8_t drawn;                          // cells currently known on screen
+    char text[TEXTFIELD_MAX_CHARS];
+    uint16_t color[TEXTFIELD_MAX_CHARS];
+    uint16_t bg[TEXTFIELD_MAX_CHARS];
+} TEXTFIELD_t;
+
+void TEXTFIELD_Init(TEXTFIELD_t *tf, uint16_t x, uint16_t y, uint8_t scale);
+void TEXTFIELD_Invalidate(TEXTFIELD_t *tf);
+void TEXTFIELD_Set(TEXTFIELD_t *tf, const char *str, uint16_t color, uint16_t bg);
+void TEXTFIELD_printf(TEXTFIELD_t *tf, uint16_t color, uint16_t bg, const char *fmt, ...);
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef DMA_H
+#define DMA_H
+
+#include "stm32f103xb.h"
+#include <stdint.h>
+
+// ---------------- DMA1 channel IDs ----------------
+// Fixed request mapping on the F103 (RM0008 table 78):
+//   CH2 SPI1_RX / USART3_TX   CH3 SPI1_TX / USART3_RX
+//   CH4 SPI2_RX / USART1_TX   CH5 SPI2_TX / USART1_RX
+//   CH6 USART2_RX             CH7 USART2_TX
+typedef enum {
+    DMA_CH1 = 1,
+    DMA_CH2,
+    DMA_CH3,
+    DMA_CH4,
+    DMA_CH5,
+    DMA_CH6,
+    DMA_CH7
+} DMA_Channel_t;
+
+// ---------------- Callback events ----------------
+#define DMA_EVENT_TC   0x1   // transfer complete
+#define DMA_EVENT_HT   0x2   // half transfer
+#define DMA_EVENT_TE   0x4   // transfer error
+
+// ---------------- Channel configuration (CCR bits) ----------------
+#define DMA_MEM_TO_PERIPH   DMA_CCR_DIR
+#define DMA_PERIPH_TO_MEM   0
+#define DMA_MINC            DMA_CCR_MINC
+#define DMA_CIRCULAR        DMA_CCR_CIRC
+#define DMA_SIZE_8BIT       0
+#define DMA_SIZE_16BIT      (DMA_CCR_PSIZE_0 | DMA_CCR_MSIZE_0)
+#define DMA_PRIO_HIGH       DMA_CCR_PL_1
+#define DMA_IRQ_HT          DMA_CCR_HTIE
+
+// Callback runs in interrupt context with the DMA_EVENT_x flags that fired
+typedef void (*DMA_Callback_t)(uint8_t events);
+
+void DMA_Init(void);
+void DMA_Start(DMA_Channel_t ch, volatile void *periph, const void *mem, uint16_t count,
+               uint32_t config, DMA_Callback_t callback);
+void DMA_Stop(DMA_Channel_t ch);
+uint8_t DMA_IsBusy(DMA_Channel_t ch);
+uint16_t DMA_GetRemaining(DMA_Channel_t ch);
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef DWT_H
+#define DWT_H
+
+#include "stm32f103xb.h"
+#include <stdint.h>
+
+// Cortex-M3 cycle counter (DWT->CYCCNT): a free-running time base that
+// needs no interrupt, for short delays and for timing code.
+
+void DWT_Init(void);
+uint32_t DWT_GetCycles(void);
+uint32_t DWT_CyclesToUs(uint32_t cycles);
+void DWT_DelayUs(uint32_t us);
+void DWT_DelayMs(uint32_t ms);
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include "stm32f103xb.h"
+#include <stdint.h>
+
+// Deferred binary logging.
+// LOG("fmt", args...) stores a 16-bit format ID and the raw argument words
+// in a RAM ring. Nothing is formatted on the MCU. LOG_Process sends the
+// records as small frames over a UART, and tools/logdecode.py rebuilds the
+// text from build/main.elf.
+//
+// Format strings go into .logstr, a section the linker keeps in the ELF but
+// never loads into flash. A string's offset in that section is its ID, so
+// the strings cost no flash and all of them together must stay below 64 KB.
+//
+// Arguments are 32-bit words: integers, chars, pointers (cast to void *)
+// and float/double (sent as a float). A %s argument must point to a
+// constant string in flash, which the decoder reads from the ELF. At most
+// LOG_MAX_ARGS arguments.
+//
+// Frame: 0x7E, argument count, ID (2 bytes LE), arguments (4 bytes LE each),
+// sum of the bytes after 0x7E. A line with one argument is 9 bytes.
+
+#ifndef LOG_BUFFER_WORDS
+#define LOG_BUFFER_WORDS  256       // ring size in 32-bit words, power of two
+#endif
+
+#define LOG_MAX_ARGS      8
+#define LOG_FRAME_SYNC    0x7E
+#define LOG_ID_DROPPED    0xFFFF    // one argument: records lost to a full ring
+
+#ifndef LOG_SECTION
+#define LOG_SECTION       ".logstr"
+#endif
+#ifndef LOG_ID
+#define LOG_ID(fmt)       ((uint16_t)(uintptr_t)(fmt))     // .logstr starts at 0
+#endif
+
+void LOG_Init(USART_TypeDef *USARTx);                 // UART must be set up by the caller
+void LOG_Write(uint16_t id, uint8_t nargs, const uint32_t *args);
+void LOG_Process(void);                               // drain the ring (main loop only)
+uint32_t LOG_GetDropped(void);                        // records lost since LOG_Init
+
+// ---------------- Argument packing ----------------
+static inline uint32_t LOG_ArgU(uint32_t v)      { return v; }
+static inline uint32_t LOG_ArgP(const void *p)   { return (uint32_t)(uintptr_t)p; }
+static inline uint32_t LOG_ArgF(double v) {
+    union { float f; uint32_t u; } bits = { (float)v };
+    return bits.u;
+}
+
+#define LOG_ARG(x) _Generic((x),                                    \
+        float: LOG_ArgF, double: LOG_ArgF,                          \
+        char *: LOG_ArgP, const char *: LOG_ArgP,                   \
+        void *: LOG_ArgP, const void *: LOG_ArgP,                   \
+        default: LOG_ArgU)(x)
+
+#define LOG_NARGS(...)  LOG_NARGS_(0, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define LOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, n, ...)  n
+
+#define LOG_CAT(a, b)   LOG_CAT_(a, b)
+#define LOG_CAT_(a, b)  a##b
+#define LOG_MAP(...)    LOG_CAT(LOG_MAP_, LOG_NARGS(__VA_ARGS__))(__VA_ARGS__)
+#define LOG_MAP_0()
+#define LOG_MAP_1(a)       LOG_ARG(a)
+#define LOG_MAP_2(a, ...)  LOG_ARG(a), LOG_MAP_1(__VA_ARGS__)
+#define LOG_MAP_3(a, ...)  LOG_ARG(a), LOG_MAP_2(__VA_ARGS__)
+#define LOG_MAP_4(a, ...)  LOG_ARG(a), LOG_MAP_3(__VA_ARGS__)
+#define LOG_MAP_5(a, ...)  LOG_ARG(a), LOG_MAP_4(__VA_ARGS__)
+#define LOG_MAP_6(a, ...)  LOG_ARG(a), LOG_MAP_5(__VA_ARGS__)
+#define LOG_MAP_7(a, ...)  LOG_ARG(a), LOG_MAP_6(__VA_ARGS__)
+#define LOG_MAP_8(a, ...)  LOG_ARG(a), LOG_MAP_7(__VA_ARGS__)
+
+// Callable from interrupts; costs the copy of (1 + nargs) words
+#define LOG(fmt, ...) do {                                                          \
+        static const char log_fmt_[] __attribute__((section(LOG_SECTION), used)) = fmt; \
+        const uint32_t log_args_[LOG_NARGS(__VA_ARGS__) + 1] = { LOG_MAP(__VA_ARGS__) }; \
+        LOG_Write(LOG_ID(log_fmt_), LOG_NARGS(__VA_ARGS__), log_args_);             \
+    } while (0)
+
+#endif
@@ -17,8 +17,27 @@ typedef enum {
 #define RCC_IOPCEN   (1 << 4)   // GPIOC clock enable
 #define RCC_AFIOEN   (1 << 0)   // AFIO clock enable
 
+#define RCC_OK   0
+#define RCC_ERR  1              // HSE did not start
+
+// PLL sources for RCC_SetSysClockPLL
+typedef enum {
+    RCC_PLL_HSI = 0,            // HSI/2 x16 = 64 MHz
+    RCC_PLL_HSE,                // 8 MHz crystal x9 = 72 MHz
+    RCC_PLL_HSE_BYPASS          // 8 MHz external clock (Nucleo: ST-LINK MCO) x9 = 72 MHz
+} RCC_PLLSource_t;
+
 // Function prototypes
 void RCC_EnableClock(RCC_Bus_t bus, uint32_t peripheral);
 void RCC_DisableClock(RCC_Bus_t bus, uint32_t peripheral);
 
+// Bus frequencies in Hz, read back from the live RCC configuration
+uint32_t RCC_GetHCLKFreq(void);
+uint32_t RCC_GetPCLK1Freq(void);
+uint32_t RCC_GetPCLK2Freq(void);
+
+// Run SYSCLK from the PLL (APB1 = HCLK/2, APB2 = HCLK). Call before the
+// peripherals are initialised: their dividers are computed from the clock.
+uint8_t RCC_SetSysClockPLL(RCC_PLLSource_t source);
+
 #endif // RCC_H
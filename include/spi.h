@@ -2,28 +2,119 @@
 #define SPI_H
 
 #include "stm32f103xb.h"
+#include "dma.h"
 #include <stdint.h>
 
 #define SPI_OK        0
 #define SPI_ERR       1
 #define SPI_TIMEOUT   2
+#define SPI_PENDING   3   // transaction queued or running
 
-#define SPI1_TIMEOUT  10000
-#define SPI2_TIMEOUT  10000
+#define SPI_DEFAULT_TIMEOUT  10000
 
-void SPI1_GPIO_Init(void);
-void SPI2_GPIO_Init(void);
+// Largest DMA chunk (CNDTR is 16-bit)
+#define SPI_DMA_MAX_CHUNK  0xFFFF
 
-void SPI1_Init(void);
-void SPI2_Init(void);
+// Queued transactions at least this long use DMA, shorter ones the SPI IRQ
+#define SPI_QUEUE_DMA_MIN  8
 
-uint8_t SPI1_Transmit(uint8_t data);
-uint8_t SPI2_Transmit(uint8_t data);
+// Clock polarity / phase
+typedef enum {
+    SPI_MODE_0 = 0,     // CPOL=0, CPHA=0
+    SPI_MODE_1,         // CPOL=0, CPHA=1
+    SPI_MODE_2,         // CPOL=1, CPHA=0
+    SPI_MODE_3          // CPOL=1, CPHA=1
+} SPI_Mode_t;
 
-uint8_t SPI1_TransmitReceive(uint8_t data);
-uint8_t SPI2_TransmitReceive(uint8_t data);
+typedef enum {
+    SPI_MSB_FIRST = 0,
+    SPI_LSB_FIRST
+} SPI_BitOrder_t;
 
-uint8_t SPI1_TransmitBuffer(uint8_t *txBuf, uint8_t *rxBuf, uint16_t len);
-uint8_t SPI2_TransmitBuffer(uint8_t *txBuf, uint8_t *rxBuf, uint16_t len);
+typedef enum {
+    SPI_DATASIZE_8BIT = 0,
+    SPI_DATASIZE_16BIT
+} SPI_DataSize_t;
+
+// Per-device bus settings
+typedef struct {
+    uint32_t maxClock;          // Hz; fastest fPCLK/2..256 not above this (0 = fPCLK/2)
+    SPI_Mode_t mode;
+    SPI_BitOrder_t bitOrder;
+    SPI_DataSize_t dataSize;
+} SPI_Config_t;
+
+// One handle per device; several handles may share the same SPIx.
+// The handle's config is loaded into the peripheral when a transfer starts.
+typedef struct {
+    SPI_TypeDef *SPIx;          // SPI1 (PA5/6/7) or SPI2 (PB13/14/15)
+    SPI_Config_t config;
+    GPIO_TypeDef *csPort;       // 0 → chip select not driven by the driver
+    uint8_t csPin;
+    uint16_t cr1;               // computed by SPI_Init
+} SPI_Handle_t;
+
+// Completion callback, runs in DMA interrupt context
+typedef void (*SPI_Callback_t)(void);
+
+// ---------------- Asynchronous transactions ----------------
+typedef struct SPI_Transaction SPI_Transaction_t;
+typedef void (*SPI_TransactionCallback_t)(SPI_Transaction_t *t);
+
+// Caller-owned; must stay valid until status != SPI_PENDING.
+// Transfers are 8-bit frames using the handle's speed/mode/bit order.
+struct SPI_Transaction {
+    SPI_Handle_t *hspi;                 // device: bus + settings
+    const uint8_t *txBuf;               // 0 → clock out 0xFF
+    uint8_t *rxBuf;                     // 0 → discard received bytes
+    uint16_t len;
+    GPIO_TypeDef *csPort;               // 0 → use the handle's CS (if any)
+    uint8_t csPin;
+    uint16_t preDelayUs;                // CS low → first SCK edge
+    uint16_t postDelayUs;               // last SCK edge → CS high
+    SPI_TransactionCallback_t callback; // interrupt context, may queue more
+    void *context;                      // free for the caller
+    volatile uint8_t status;            // SPI_PENDING → SPI_OK / SPI_ERR
+    SPI_Transaction_t *next;            // queue link, managed by the driver
+};
+
+void SPI_Init(SPI_Handle_t *hspi);
+uint32_t SPI_GetClock(SPI_Handle_t *hspi);
+
+void SPI_Begin(SPI_Handle_t *hspi);
+void SPI_End(SPI_Handle_t *hspi);
+
+// Keep queued transactions off the bus without touching CS, e.g. while a
+// DC line is set up for a fill; nests, one SPI_Release per SPI_Claim
+void SPI_Claim(SPI_Handle_t *hspi);
+void SPI_Release(SPI_Handle_t *hspi);
+
+// All transfer functions return SPI_OK / SPI_TIMEOUT; received data goes
+// through the rx pointers, so a 0xFF data byte is never mistaken for an error.
+uint8_t SPI_TransmitReceive(SPI_Handle_t *hspi, uint8_t data, uint8_t *rx);
+uint8_t SPI_Transmit(SPI_Handle_t *hspi, uint8_t data);
+uint8_t SPI_TransmitBuffer(SPI_Handle_t *hspi, uint8_t *txBuf, uint8_t *rxBuf, uint16_t len);
+
+// TX-only burst for write-only devices: no RXNE waits, OVR drained once,
+// returns after BSY=0 so CS/DC may change immediately
+uint8_t SPI_Write(SPI_Handle_t *hspi, const uint8_t *txBuf, uint32_t len);
+
+// Runtime frame-size switch (DFF); waits for the bus to go idle first
+void SPI_SetDataSize(SPI_Handle_t *hspi, SPI_DataSize_t size);
+
+// Back-to-back 16-bit TX-only stream (handle must be in SPI_DATASIZE_16BIT)
+uint8_t SPI_TransmitBuffer16(SPI_Handle_t *hspi, const uint16_t *txBuf, uint32_t len);
+
+// Repeat one 16-bit word 'count' times over the bus TX DMA channel
+// (DMA1 CH3 for SPI1, CH5 for SPI2).
+// callback == 0 → blocks until the last frame has left the shifter.
+uint8_t SPI_FillDMA(SPI_Handle_t *hspi, uint16_t value, uint32_t count, SPI_Callback_t callback);
+uint8_t SPI_IsBusy(SPI_Handle_t *hspi);
+
+// Append to the bus queue and return immediately; runs from SPI/DMA IRQs.
+// Blocking calls on the same bus wait for the running transaction and hold
+// the queue until they return (SPI_Begin: until SPI_End), so they must not
+// be made from a transaction callback.
+uint8_t SPI_Queue(SPI_Transaction_t *t);
 
 #endif
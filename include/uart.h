@@ -2,6 +2,22 @@
 #define UART_H
 
 #include "stm32f103xb.h"
+#include "dma.h"
+
+// ---------------- Buffered transmit ----------------
+// Writes are copied into a per-USART ring and sent by the TXE interrupt, so
+// a log line costs the copy instead of the wire time (with txDma, DMA
+// empties the ring instead; see below).
+#ifndef UART_TX_BUFFER_SIZE
+#define UART_TX_BUFFER_SIZE  256    // bytes per USART, power of two
+#endif
+
+// What a write does when the ring is full
+typedef enum {
+    UART_TX_BLOCK = 0,              // wait for room (default)
+    UART_TX_DROP,                   // discard the bytes that do not fit
+    UART_TX_OVERWRITE               // discard the oldest queued bytes
+} UART_TxPolicy_t;
 
 typedef enum {
     UART_WORDLENGTH_8B = 0,
@@ -19,18 +35,63 @@ typedef enum {
     UART_PARITY_ODD
 } UART_Parity_t;
 
+// ---------------- DMA receive ----------------
+// RX runs into a caller-owned circular DMA buffer (DMA1 CH5 for USART1,
+// CH6 for USART2, CH3 for USART3; CH5/CH3 are shared with SPI2/SPI1 TX).
+// New bytes are handed out as spans pointing into that buffer when the line
+// goes idle and at every half/full buffer, not per character.
+// A span stays valid until the DMA comes round again: the buffer must hold
+// everything that can arrive before the application has processed it.
+
+// Runs in interrupt context; a wrap gives two calls
+typedef void (*UART_RxCallback_t)(USART_TypeDef *USARTx, const uint8_t *data, uint16_t len);
+
+// ---------------- DMA transmit ----------------
+// With txDma set the ring is sent in contiguous DMA chunks instead of one
+// TXE interrupt per byte (DMA1 CH4 for USART1, CH7 for USART2, CH2 for
+// USART3; CH4/CH2 are shared with SPI2/SPI1 RX).
+// UART_WriteAsync queues caller-owned buffers behind the ring contents
+// without copying them; it works in TXE mode too.
+typedef struct UART_TxSegment UART_TxSegment_t;
+typedef void (*UART_TxCallback_t)(UART_TxSegment_t *seg);
+
+// Caller-owned; descriptor and data must stay valid while pending
+struct UART_TxSegment {
+    const uint8_t *data;
+    uint16_t len;
+    UART_TxCallback_t callback;         // interrupt context, may queue more
+    void *context;                      // free for the caller
+    UART_TxSegment_t *next;             // chain: sent back to back (0 ends it)
+    volatile uint8_t pending;           // 1 until the last byte is in the USART
+    uint16_t ringMark;                  // managed by the driver
+};
+
 typedef struct {
-    uint32_t baudRate;
+    uint32_t baudRate;                  // up to PCLK/16: 4.5 Mbaud on USART1 at 72 MHz
     UART_WordLength_t wordLength;
     UART_StopBits_t stopBits;
     UART_Parity_t parity;
     uint8_t enableTx;
     uint8_t enableRx;
+    UART_TxPolicy_t txPolicy;
+    uint8_t txDma;                      // 1 → send through the TX DMA channel
 } UART_Config_t;
 
 void UART_Init(USART_TypeDef *USARTx, UART_Config_t *config);
+uint32_t UART_GetBaudRate(USART_TypeDef *USARTx);   // actual rate from BRR and the bus clock
+int32_t UART_GetBaudError(USART_TypeDef *USARTx);   // actual vs requested, in ppm
 void UART_WriteChar(USART_TypeDef *USARTx, char c);
 void UART_WriteString(USART_TypeDef *USARTx, const char *str);
+void UART_Write(USART_TypeDef *USARTx, const uint8_t *data, uint32_t len);
+void UART_WriteAsync(USART_TypeDef *USARTx, UART_TxSegment_t *seg);
+void UART_Flush(USART_TypeDef *USARTx);             // wait until the last bit is out (ring + segments)
+uint32_t UART_GetTxDropped(USART_TypeDef *USARTx);  // bytes lost to DROP/OVERWRITE
 char UART_ReadChar(USART_TypeDef *USARTx);
 
+// callback == 0 → poll with UART_ReadSpan / UART_ReadChar
+void UART_StartRxDMA(USART_TypeDef *USARTx, uint8_t *buf, uint16_t size, UART_RxCallback_t callback);
+void UART_StopRxDMA(USART_TypeDef *USARTx);
+uint16_t UART_ReadSpan(USART_TypeDef *USARTx, const uint8_t **data);  // next unread span, 0 if none
+uint32_t UART_GetRxOverruns(USART_TypeDef *USARTx);   // times unread data was overwritten
+
 #endif
@@ -10,13 +10,22 @@
 
 // Temporary buffer size for number/string conversion
 #define MINI_PRINTF_BUF_SIZE 32
+// Longest formatted line for the display printf helpers
+#define MINI_PRINTF_LINE_SIZE 64
 #define TRUE 1
 #define FALSE 0
 
 void LED_On(void);
 void LED_Off(void);
 void LED_Toggle(void);
+// Receives formatted text in runs (not NUL-terminated)
+typedef void (*mini_sink_t)(void *ctx, const char *data, uint32_t len);
+
+int mini_vformat(mini_sink_t sink, void *ctx, const char *fmt, va_list args);
+int mini_format(mini_sink_t sink, void *ctx, const char *fmt, ...);
 void mini_printf(const char *fmt, ...);
+int mini_vsnprintf(char *buf, uint32_t size, const char *fmt, va_list args);
+int mini_snprintf(char *buf, uint32_t size, const char *fmt, ...);
 void ST7789_mini_printf(uint16_t x, uint16_t y, uint16_t color, uint16_t bg, uint8_t scale, const char *fmt, ...);
 
 #endif // _UTILITY_H
\ No newline at end of file
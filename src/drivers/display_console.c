@@ -0,0 +1,139 @@
+#include "display_console.h"
+#include "utility.h"   // mini_vsnprintf
+#include <stdarg.h>
+
+// ===============================
+// --- Console State ---
+// ===============================
+
+static char lines[CONSOLE_MAX_ROWS][CONSOLE_COLS]; // ring of text rows
+static uint16_t tfa = 0;         // top fixed rows (pixels)
+static uint8_t rows = CONSOLE_MAX_ROWS;
+static uint8_t first = 0;        // ring index shown at the top of the scroll area
+static uint8_t cursor_row = 0;   // visible row (0 = top)
+static uint8_t cursor_col = 0;
+static uint16_t fg_color = ST7789_COLOR_WHITE;
+static uint16_t bg_color = ST7789_COLOR_BLACK;
+
+// Pending (not yet drawn) columns of the cursor row
+static uint8_t dirty_from = CONSOLE_COLS;
+static uint8_t dirty_to = 0;
+
+// Frame-memory y of a visible console row
+static uint16_t CONSOLE_RowY(uint8_t row) {
+    return tfa + ((first + row) % rows) * 8;
+}
+
+static char *CONSOLE_Line(uint8_t row) {
+    return lines[(first + row) % rows];
+}
+
+// Draw columns [from, to) of a visible row as one text run
+static void CONSOLE_DrawSpan(uint8_t row, uint8_t from, uint8_t to) {
+    char run[CONSOLE_COLS + 1];
+    const char *line = CONSOLE_Line(row);
+    uint8_t n = 0;
+    for(uint8_t i = from; i < to; i++) run[n++] = line[i];
+    run[n] = '\0';
+    ST7789_DrawString(from * 6, CONSOLE_RowY(row), run, fg_color, bg_color);
+}
+
+static void CONSOLE_FlushCursorRow(void) {
+    if(dirty_from < dirty_to) CONSOLE_DrawSpan(cursor_row, dirty_from, dirty_to);
+    dirty_from = CONSOLE_COLS;
+    dirty_to = 0;
+}
+
+// ===============================
+// --- Scrolling ---
+// ===============================
+
+static void CONSOLE_NewLine(void) {
+    CONSOLE_FlushCursorRow();
+    cursor_col = 0;
+
+    if(cursor_row + 1 < rows) {
+        cursor_row++;
+        return;
+    }
+
+    // Bottom reached: the oldest row becomes the new bottom row.
+    // Blank it in RAM and on the panel, then move the scroll start by 8 lines.
+    first = (first + 1) % rows;
+    char *line = CONSOLE_Line(cursor_row);
+    for(uint8_t i = 0; i < CONSOLE_COLS; i++) line[i] = ' ';
+    CONSOLE_DrawSpan(cursor_row, 0, CONSOLE_COLS);
+    ST7789_SetScrollStart(tfa + first * 8);
+}
+
+// ===============================
+// --- Public API ---
+// ===============================
+
+// top_fixed: rows (multiple of 8) at the top that do not scroll, e.g. a title bar
+void CONSOLE_Init(uint16_t top_fixed, uint16_t color, uint16_t bg) {
+    if(top_fixed > ST7789_PANEL_HEIGHT - 8) top_fixed = ST7789_PANEL_HEIGHT - 8;
+    tfa = top_fixed - (top_fixed % 8);
+    rows = (ST7789_PANEL_HEIGHT - tfa) / 8;
+    fg_color = color;
+    bg_color = bg;
+
+    // Scroll area ends at the last visible row; the 80 off-panel rows are bottom-fixed
+    ST7789_SetScrollArea(tfa, rows * 8, ST7789_MEM_HEIGHT - tfa - rows * 8);
+    CONSOLE_Clear();
+}
+
+void CONSOLE_SetColor(uint16_t color, uint16_t bg) {
+    CONSOLE_FlushCursorRow();
+    fg_color = color;
+    bg_color = bg;
+}
+
+void CONSOLE_Clear(void) {
+    for(uint8_t r = 0; r < rows; r++)
+        for(uint8_t c = 0; c < CONSOLE_COLS; c++) lines[r][c] = ' ';
+
+    first = 0;
+    cursor_row = 0;
+    cursor_col = 0;
+    dirty_from = CONSOLE_COLS;
+    dirty_to = 0;
+
+    ST7789_SetScrollStart(tfa);
+    ST7789_FillRect(0, tfa, ST7789_PANEL_WIDTH, rows * 8, bg_color);
+}
+
+// Text is buffered per row and drawn when the row ends or on CONSOLE_Write return
+void CONSOLE_PutChar(char c) {
+    if(c == '\n') { CONSOLE_NewLine(); return; }
+    if(c == '\r') { CONSOLE_FlushCursorRow(); cursor_col = 0; return; }
+    if(c == '\b') { if(cursor_col) cursor_col--; return; }
+
+    if(cursor_col >= CONSOLE_COLS) CONSOLE_NewLine(); // wrap
+
+    CONSOLE_Line(cursor_row)[cursor_col] = c;
+    if(cursor_col < dirty_from) dirty_from = cursor_col;
+    if(cursor_col + 1 > dirty_to) dirty_to = cursor_col + 1;
+    cursor_col++;
+}
+
+void CONSOLE_Write(const char *str) {
+    while(*str) CONSOLE_PutChar(*str++);
+    CONSOLE_FlushCursorRow();
+}
+
+void CONSOLE_printf(const char *fmt, ...) {
+    char buf[MINI_PRINTF_LINE_SIZE];
+    va_list args;
+    va_start(args, fmt);
+    mini_vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+
+    CONSOLE_Write(buf);
+}
+
+// Repaint every row from the RAM ring (after something else drew over it)
+void CONSOLE_Redraw(void) {
+    CONSOLE_FlushCursorRow();
+    for(uint8_t r = 0; r < rows; r++) CONSOLE_DrawSpan(r, 0, CONSOLE_COLS);
+}
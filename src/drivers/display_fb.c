@@ -0,0 +1,208 @@
+#include "display_fb.h"
+#include <stdint.h>
+
+// ===============================
+// --- Framebuffer State ---
+// ===============================
+
+// Widening a window by a few pixels is cheaper than a new CASET/RASET pair
+// (~11 bytes), so neighbouring rows are merged while the waste stays below this
+#define FB_MERGE_SLACK  6
+
+static uint8_t fb[FB_BUFFER_BYTES];
+static uint16_t fb_x, fb_y;             // panel position
+static uint16_t fb_w = 0, fb_h = 0;
+static uint16_t fb_stride;              // bytes per row
+static uint8_t fb_bpp;
+static const uint16_t *fb_palette;
+
+// Dirty columns per row (inclusive); x0 > x1 = clean
+static uint8_t dirty_x0[ST7789_MAX_SIDE];
+static uint8_t dirty_x1[ST7789_MAX_SIDE];
+
+static uint16_t line[ST7789_MAX_SIDE];  // one expanded RGB565 row
+
+static void FB_MarkRow(uint16_t y, uint16_t x0, uint16_t x1) {
+    if(x0 < dirty_x0[y]) dirty_x0[y] = (uint8_t)x0;
+    if(x1 > dirty_x1[y]) dirty_x1[y] = (uint8_t)x1;
+}
+
+// Write one clipped, non-empty span of row y and mark it dirty
+static void FB_Span(uint16_t x0, uint16_t x1, uint16_t y, uint8_t index) {
+    uint8_t *row = &fb[y * fb_stride];
+    FB_MarkRow(y, x0, x1);
+
+    if(fb_bpp == 8) {
+        for(uint16_t x = x0; x <= x1; x++) row[x] = index;
+        return;
+    }
+
+    // 4 bpp, left pixel in the high nibble: odd edges by hand, whole bytes between
+    index &= 0x0F;
+    if(x0 & 1) {
+        row[x0 >> 1] = (row[x0 >> 1] & 0xF0) | index;
+        x0++;
+    }
+    if(x0 <= x1 && !(x1 & 1)) {
+        row[x1 >> 1] = (row[x1 >> 1] & 0x0F) | (index << 4);
+        if(x1 == 0) return;
+        x1--;
+    }
+    for(uint16_t i = x0 >> 1; x0 < x1 && i <= (x1 >> 1); i++) row[i] = index * 0x11;
+}
+
+// ===============================
+// --- Setup ---
+// ===============================
+
+// bpp is 4 or 8; the palette (16 or 256 RGB565 entries) is read at flush
+// time and may live in flash. Everything is cleared to index 0 and dirty.
+uint8_t FB_Init(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t bpp, const uint16_t *palette) {
+    uint16_t stride = (bpp == 4) ? (w + 1) / 2 : w;
+
+    if((bpp != 4 && bpp != 8) || w == 0 || h == 0) return FB_ERR;
+    if(x + w > ST7789_WIDTH || y + h > ST7789_HEIGHT) return FB_ERR;
+    if((uint32_t)stride * h > FB_BUFFER_BYTES) return FB_ERR;
+
+    fb_x = x; fb_y = y;
+    fb_w = w; fb_h = h;
+    fb_stride = stride;
+    fb_bpp = bpp;
+    fb_palette = palette;
+
+    FB_Clear(0);
+    return FB_OK;
+}
+
+// New colours for every index; the whole area is resent on the next flush
+void FB_SetPalette(const uint16_t *palette) {
+    fb_palette = palette;
+    FB_Invalidate();
+}
+
+void FB_Invalidate(void) {
+    for(uint16_t y = 0; y < fb_h; y++) {
+        dirty_x0[y] = 0;
+        dirty_x1[y] = (uint8_t)(fb_w - 1);
+    }
+}
+
+// ===============================
+// --- Drawing ---
+// ===============================
+
+void FB_Clear(uint8_t index) {
+    uint8_t fill = (fb_bpp == 4) ? (index & 0x0F) * 0x11 : index;
+    for(uint32_t i = 0; i < (uint32_t)fb_stride * fb_h; i++) fb[i] = fill;
+    FB_Invalidate();
+}
+
+void FB_DrawPixel(int16_t x, int16_t y, uint8_t index) {
+    if(x < 0 || y < 0 || x >= fb_w || y >= fb_h) return;
+    FB_Span(x, x, y, index);
+}
+
+uint8_t FB_GetPixel(int16_t x, int16_t y) {
+    if(x < 0 || y < 0 || x >= fb_w || y >= fb_h) return 0;
+    uint8_t b = fb[y * fb_stride + (fb_bpp == 4 ? x >> 1 : x)];
+    if(fb_bpp == 8) return b;
+    return (x & 1) ? (b & 0x0F) : (b >> 4);
+}
+
+void FB_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t index) {
+    // Clip in 32 bits so x + w cannot wrap
+    int32_t x0 = x, y0 = y, x1 = (int32_t)x + w - 1, y1 = (int32_t)y + h - 1;
+    if(w <= 0 || h <= 0) return;
+    if(x0 < 0) x0 = 0;
+    if(y0 < 0) y0 = 0;
+    if(x1 >= fb_w) x1 = fb_w - 1;
+    if(y1 >= fb_h) y1 = fb_h - 1;
+    if(x0 > x1 || y0 > y1) return;
+
+    for(int32_t row = y0; row <= y1; row++) FB_Span(x0, x1, row, index);
+}
+
+void FB_DrawHLine(int16_t x, int16_t y, int16_t w, uint8_t index) {
+    FB_FillRect(x, y, w, 1, index);
+}
+
+void FB_DrawVLine(int16_t x, int16_t y, int16_t h, uint8_t index) {
+    FB_FillRect(x, y, 1, h, index);
+}
+
+// 5x7 font in 6x8 cells, clipped at the framebuffer edges.
+// bg = FB_TRANSPARENT draws only the glyph pixels.
+void FB_DrawString(int16_t x, int16_t y, const char *str, uint8_t index, uint16_t bg) {
+    for(; *str && x < (int16_t)fb_w; str++, x += 6) {
+        const uint8_t *glyph = ST7789_GetGlyph(*str);
+
+        for(uint8_t col = 0; col < 6; col++) {
+            uint8_t bits = (glyph && col < 5) ? glyph[col] : 0;
+            for(uint8_t row = 0; row < 8; row++) {
+                if(bits & (1 << row)) FB_DrawPixel(x + col, y + row, index);
+                else if(bg != FB_TRANSPARENT) FB_DrawPixel(x + col, y + row, (uint8_t)bg);
+            }
+        }
+    }
+}
+
+// ===============================
+// --- Flush ---
+// ===============================
+
+// Palette-expand columns x0..x1 of row y into the line buffer
+static void FB_ExpandRow(uint16_t y, uint16_t x0, uint16_t x1) {
+    const uint8_t *row = &fb[y * fb_stride];
+    uint16_t *dst = line;
+
+    if(fb_bpp == 8) {
+        for(uint16_t x = x0; x <= x1; x++) *dst++ = fb_palette[row[x]];
+        return;
+    }
+
+    uint16_t x = x0;
+    if(x & 1) *dst++ = fb_palette[row[x++ >> 1] & 0x0F];
+    for(; x + 1 <= x1; x += 2) {
+        uint8_t b = row[x >> 1];
+        *dst++ = fb_palette[b >> 4];
+        *dst++ = fb_palette[b & 0x0F];
+    }
+    if(x == x1) *dst = fb_palette[row[x >> 1] >> 4];
+}
+
+// Send every dirty row. Consecutive dirty rows share one address window
+// (their column union) as long as the extra pixels cost less than new
+// window commands, so a cleared or filled area goes out as a single burst.
+void FB_Flush(void) {
+    uint16_t y = 0;
+
+    while(y < fb_h) {
+        if(dirty_x0[y] > dirty_x1[y]) { y++; continue; }
+
+        // Grow a block of rows [y, end)
+        uint16_t bx0 = dirty_x0[y], bx1 = dirty_x1[y];
+        uint32_t used = bx1 - bx0 + 1;          // dirty pixels in the block
+        uint16_t end = y + 1;
+
+        while(end < fb_h && dirty_x0[end] <= dirty_x1[end]) {
+            uint16_t ux0 = (dirty_x0[end] < bx0) ? dirty_x0[end] : bx0;
+            uint16_t ux1 = (dirty_x1[end] > bx1) ? dirty_x1[end] : bx1;
+            uint32_t rows = end - y + 1;
+            uint32_t waste_before = (uint32_t)(bx1 - bx0 + 1) * (rows - 1) - used;
+            uint32_t waste_after = (uint32_t)(ux1 - ux0 + 1) * rows - (used + dirty_x1[end] - dirty_x0[end] + 1);
+            if(waste_after > waste_before + FB_MERGE_SLACK) break;
+
+            bx0 = ux0; bx1 = ux1;
+            used += dirty_x1[end] - dirty_x0[end] + 1;
+            end++;
+        }
+
+        ST7789_SetAddressWindow(fb_x + bx0, fb_y + y, fb_x + bx1, fb_y + end - 1);
+        for(; y < end; y++) {
+            FB_ExpandRow(y, bx0, bx1);
+            ST7789_WritePixels(line, bx1 - bx0 + 1);
+            dirty_x0[y] = 0xFF;
+            dirty_x1[y] = 0;
+        }
+    }
+}
@@ -0,0 +1,116 @@
+#include "display_font.h"
+
+// ===============================
+// --- Glyph Lookup ---
+// ===============================
+
+static const FONT_Glyph_t *FONT_GetGlyph(const FONT_t *font, char c) {
+    uint8_t code = (uint8_t)c;
+    if(code < font->first || code > font->last) return 0;
+    return &font->glyphs[code - font->first];
+}
+
+// Pen advance of one line (up to '\n' or the end of the string)
+uint16_t FONT_TextWidth(const FONT_t *font, const char *str) {
+    uint16_t w = 0;
+    for(; *str && *str != '\n'; str++) {
+        const FONT_Glyph_t *g = FONT_GetGlyph(font, *str);
+        if(g) w += g->xAdvance;
+    }
+    return w;
+}
+
+// ===============================
+// --- Shading ---
+// ===============================
+
+// Colour for every alpha level, blended per RGB565 channel
+static void FONT_BuildShades(uint16_t *shades, uint8_t bpp, uint16_t color, uint16_t bg) {
+    uint8_t levels = (1 << bpp) - 1;
+    for(uint8_t a = 0; a <= levels; a++) {
+        uint16_t r = (((color >> 11) & 0x1F) * a + ((bg >> 11) & 0x1F) * (levels - a)) / levels;
+        uint16_t g = (((color >> 5) & 0x3F) * a + ((bg >> 5) & 0x3F) * (levels - a)) / levels;
+        uint16_t b = ((color & 0x1F) * a + (bg & 0x1F) * (levels - a)) / levels;
+        shades[a] = (r << 11) | (g << 5) | b;
+    }
+}
+
+// ===============================
+// --- Draw Line of Text ---
+// ===============================
+
+// One address window for the whole line; each pixel row is composed from
+// the glyph rows it crosses and streamed as one burst.
+static void FONT_DrawLine(uint16_t x, uint16_t y, const char *str, uint16_t n, const FONT_t *font, const uint16_t *shades) {
+    static uint16_t line[ST7789_MAX_SIDE];
+    static uint8_t cover[ST7789_MAX_SIDE];    // alpha already written, for overlapping glyphs
+    if(x >= ST7789_WIDTH || y >= ST7789_HEIGHT || n == 0) return;
+
+    // Window covers the pen advance and any ink hanging past it
+    int16_t w = 0, pen = 0;
+    for(uint16_t i = 0; i < n; i++) {
+        const FONT_Glyph_t *g = FONT_GetGlyph(font, str[i]);
+        if(!g) continue;
+        if(pen + g->xOffset + g->width > w) w = pen + g->xOffset + g->width;
+        pen += g->xAdvance;
+    }
+    if(pen > w) w = pen;
+    if(w == 0) return;
+    if(x + w > ST7789_WIDTH) w = ST7789_WIDTH - x;
+    uint16_t h = (y + font->height > ST7789_HEIGHT) ? ST7789_HEIGHT - y : font->height;
+
+    uint8_t bpp = font->bpp;
+    uint8_t mask = (1 << bpp) - 1;
+
+    ST7789_SetAddressWindow(x, y, x + w - 1, y + h - 1);
+
+    for(uint16_t row = 0; row < h; row++) {
+        for(int16_t i = 0; i < w; i++) { line[i] = shades[0]; cover[i] = 0; }
+
+        pen = 0;
+        for(uint16_t i = 0; i < n && pen < w; i++) {
+            const FONT_Glyph_t *g = FONT_GetGlyph(font, str[i]);
+            if(!g) continue;
+
+            int16_t gy = (int16_t)row - (font->baseline + g->yOffset);
+            if(gy >= 0 && gy < g->height) {
+                const uint8_t *bits = font->bitmap + g->offset;
+                uint32_t bit = (uint32_t)gy * g->width * bpp;
+                int16_t px = pen + g->xOffset;
+
+                for(uint8_t gx = 0; gx < g->width; gx++, px++, bit += bpp) {
+                    uint8_t a = (bits[bit >> 3] >> (8 - bpp - (bit & 7))) & mask;
+                    if(a == 0 || px < 0 || px >= w || a < cover[px]) continue;
+                    line[px] = shades[a];
+                    cover[px] = a;
+                }
+            }
+            pen += g->xAdvance;
+        }
+
+        ST7789_WritePixels(line, w);
+    }
+}
+
+// ===============================
+// --- Draw String ---
+// ===============================
+
+// (x,y) is the top-left of the first line; '\n' starts a new line below.
+// Text past the right edge is clipped, not wrapped.
+void FONT_DrawString(uint16_t x, uint16_t y, const char *str, const FONT_t *font, uint16_t color, uint16_t bg) {
+    uint16_t shades[16];
+    if(!font || (font->bpp != 1 && font->bpp != 2 && font->bpp != 4)) return;
+    FONT_BuildShades(shades, font->bpp, color, bg);
+
+    while(*str && y < ST7789_HEIGHT) {
+        uint16_t n = 0;
+        while(str[n] && str[n] != '\n') n++;
+
+        FONT_DrawLine(x, y, str, n, font, shades);
+
+        str += n;
+        if(*str == '\n') str++;
+        y += font->height;
+    }
+}
@@ -0,0 +1,215 @@
+#include "display_render.h"
+#include <stdint.h>
+
+// ===============================
+// --- Recorded Draw Operations ---
+// ===============================
+
+#define RENDER_NO_TEXT  0xFFFF
+
+typedef struct {
+    uint16_t x, y, w, h;   // covered area, clipped to the panel
+    uint16_t color;
+    uint16_t bg;           // text background
+    uint16_t text;         // offset in text_pool, RENDER_NO_TEXT for a fill
+    uint8_t  len;          // characters in the text run
+    uint8_t  scale;
+} RENDER_Op_t;
+
+typedef struct {
+    uint16_t x0, y0, x1, y1; // inclusive
+} RENDER_Rect_t;
+
+static RENDER_Op_t ops[RENDER_MAX_OPS];
+static uint8_t op_count = 0;
+
+static char text_pool[RENDER_TEXT_POOL];
+static uint16_t text_used = 0;
+
+static uint16_t strip[RENDER_STRIP_PIXELS];
+
+// Clip (x,y,w,h) to the panel; returns 0 if nothing is left
+static uint8_t RENDER_Clip(uint16_t *x, uint16_t *y, uint16_t *w, uint16_t *h) {
+    if(*x >= ST7789_WIDTH || *y >= ST7789_HEIGHT || *w == 0 || *h == 0) return 0;
+    if(*x + *w > ST7789_WIDTH)  *w = ST7789_WIDTH - *x;
+    if(*y + *h > ST7789_HEIGHT) *h = ST7789_HEIGHT - *y;
+    return 1;
+}
+
+// Next free op slot; flushes the frame when the list is full
+static RENDER_Op_t *RENDER_NewOp(uint16_t text_bytes) {
+    if(op_count >= RENDER_MAX_OPS || text_used + text_bytes > RENDER_TEXT_POOL)
+        RENDER_Flush();
+    return &ops[op_count++];
+}
+
+// ===============================
+// --- Public Draw Calls ---
+// ===============================
+
+// Drop everything recorded since the last flush
+void RENDER_Begin(void) {
+    op_count = 0;
+    text_used = 0;
+}
+
+void RENDER_FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    if(!RENDER_Clip(&x, &y, &w, &h)) return;
+
+    RENDER_Op_t *op = RENDER_NewOp(0);
+    op->x = x; op->y = y; op->w = w; op->h = h;
+    op->color = color;
+    op->text = RENDER_NO_TEXT;
+}
+
+void RENDER_FillScreen(uint16_t color) {
+    // Everything recorded so far is hidden: start over with one full-screen op
+    RENDER_Begin();
+    RENDER_FillRect(0, 0, ST7789_WIDTH, ST7789_HEIGHT, color);
+}
+
+// Text runs paint whole 6x8 cells (glyph + spacing column) in color/bg.
+// No line wrap: the run is clipped at the right edge of the panel.
+void RENDER_DrawStringScaled(uint16_t x, uint16_t y, const char *str, uint16_t color, uint16_t bg, uint8_t scale) {
+    if(scale == 0) scale = 1;
+
+    uint16_t len = 0;
+    while(str[len] && len < 255 && x + (len * 6 * scale) < ST7789_WIDTH) len++;
+
+    uint16_t w = len * 6 * scale, h = 8 * scale;
+    if(len == 0 || len > RENDER_TEXT_POOL || !RENDER_Clip(&x, &y, &w, &h)) return;
+
+    RENDER_Op_t *op = RENDER_NewOp(len);
+    op->x = x; op->y = y; op->w = w; op->h = h;
+    op->color = color;
+    op->bg = bg;
+    op->len = (uint8_t)len;
+    op->scale = scale;
+    op->text = text_used;
+
+    for(uint16_t i = 0; i < len; i++) text_pool[text_used++] = str[i];
+}
+
+void RENDER_DrawString(uint16_t x, uint16_t y, const char *str, uint16_t color, uint16_t bg) {
+    RENDER_DrawStringScaled(x, y, str, color, bg, 1);
+}
+
+// ===============================
+// --- Composition ---
+// ===============================
+
+// Paint the part of 'op' inside rect r into the strip (row stride = width of r)
+static void RENDER_ComposeOp(const RENDER_Op_t *op, const RENDER_Rect_t *r) {
+    uint16_t x0 = (op->x > r->x0) ? op->x : r->x0;
+    uint16_t y0 = (op->y > r->y0) ? op->y : r->y0;
+    uint16_t x1 = (op->x + op->w - 1 < r->x1) ? op->x + op->w - 1 : r->x1;
+    uint16_t y1 = (op->y + op->h - 1 < r->y1) ? op->y + op->h - 1 : r->y1;
+    if(x0 > x1 || y0 > y1) return;
+
+    uint16_t stride = r->x1 - r->x0 + 1;
+
+    for(uint16_t y = y0; y <= y1; y++) {
+        uint16_t *dst = &strip[(y - r->y0) * stride + (x0 - r->x0)];
+
+        if(op->text == RENDER_NO_TEXT) {
+            for(uint16_t x = x0; x <= x1; x++) *dst++ = op->color;
+            continue;
+        }
+
+        // Walk the glyph grid with counters instead of per-pixel divisions
+        uint8_t  row  = (y - op->y) / op->scale;
+        uint16_t dx   = x0 - op->x;
+        uint16_t cell = dx / (6 * op->scale);
+        uint16_t sub  = dx % (6 * op->scale);
+        uint8_t  col  = sub / op->scale;
+        uint8_t  rep  = sub % op->scale;
+        const uint8_t *glyph = ST7789_GetGlyph(text_pool[op->text + cell]);
+
+        for(uint16_t x = x0; x <= x1; x++) {
+            uint8_t on = (glyph && col < 5 && row < 8) ? ((glyph[col] >> row) & 1) : 0;
+            *dst++ = on ? op->color : op->bg;
+
+            if(++rep == op->scale) {
+                rep = 0;
+                if(++col == 6) {
+                    col = 0;
+                    if(++cell < op->len) glyph = ST7789_GetGlyph(text_pool[op->text + cell]);
+                }
+            }
+        }
+    }
+}
+
+// Two rects may share one window only if their union is exactly the bounding box
+static uint8_t RENDER_CanMerge(const RENDER_Rect_t *a, const RENDER_Rect_t *b) {
+    // one contains the other
+    if(a->x0 <= b->x0 && a->x1 >= b->x1 && a->y0 <= b->y0 && a->y1 >= b->y1) return 1;
+    if(b->x0 <= a->x0 && b->x1 >= a->x1 && b->y0 <= a->y0 && b->y1 >= a->y1) return 1;
+    // same rows, overlapping or touching columns
+    if(a->y0 == b->y0 && a->y1 == b->y1 && a->x0 <= b->x1 + 1 && b->x0 <= a->x1 + 1) return 1;
+    // same columns, overlapping or touching rows
+    if(a->x0 == b->x0 && a->x1 == b->x1 && a->y0 <= b->y1 + 1 && b->y0 <= a->y1 + 1) return 1;
+    return 0;
+}
+
+// Compose and push every dirty region of one band
+static void RENDER_FlushBand(uint16_t band_y0, uint16_t band_y1) {
+    RENDER_Rect_t dirty[RENDER_MAX_OPS];
+    uint8_t n = 0;
+
+    // Collect op extents clipped to the band
+    for(uint8_t i = 0; i < op_count; i++) {
+        const RENDER_Op_t *op = &ops[i];
+        if(op->y > band_y1 || op->y + op->h - 1 < band_y0) continue;
+        dirty[n].x0 = op->x;
+        dirty[n].x1 = op->x + op->w - 1;
+        dirty[n].y0 = (op->y > band_y0) ? op->y : band_y0;
+        dirty[n].y1 = (op->y + op->h - 1 < band_y1) ? op->y + op->h - 1 : band_y1;
+        n++;
+    }
+
+    // Merge regions whose union is rectangular until nothing changes
+    uint8_t merged = 1;
+    while(merged) {
+        merged = 0;
+        for(uint8_t i = 0; i < n; i++) {
+            for(uint8_t j = i + 1; j < n; j++) {
+                if(!RENDER_CanMerge(&dirty[i], &dirty[j])) continue;
+                if(dirty[j].x0 < dirty[i].x0) dirty[i].x0 = dirty[j].x0;
+                if(dirty[j].y0 < dirty[i].y0) dirty[i].y0 = dirty[j].y0;
+                if(dirty[j].x1 > dirty[i].x1) dirty[i].x1 = dirty[j].x1;
+                if(dirty[j].y1 > dirty[i].y1) dirty[i].y1 = dirty[j].y1;
+                dirty[j--] = dirty[--n];
+                merged = 1;
+            }
+        }
+    }
+
+    // One window per region; ops are replayed in order so later draws win
+    for(uint8_t k = 0; k < n; k++) {
+        RENDER_Rect_t *r = &dirty[k];
+        for(uint8_t i = 0; i < op_count; i++) RENDER_ComposeOp(&ops[i], r);
+
+        ST7789_SetAddressWindow(r->x0, r->y0, r->x1, r->y1);
+        ST7789_WritePixels(strip, (uint32_t)(r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1));
+    }
+}
+
+void RENDER_Flush(void) {
+    if(op_count == 0) return;
+
+    // Only visit bands that some op touches
+    uint16_t top = ST7789_HEIGHT, bottom = 0;
+    for(uint8_t i = 0; i < op_count; i++) {
+        if(ops[i].y < top) top = ops[i].y;
+        if(ops[i].y + ops[i].h > bottom) bottom = ops[i].y + ops[i].h;
+    }
+
+    for(uint16_t y = top - (top % RENDER_BAND_HEIGHT); y < bottom; y += RENDER_BAND_HEIGHT) {
+        uint16_t y1 = y + RENDER_BAND_HEIGHT - 1;
+        if(y1 >= ST7789_HEIGHT) y1 = ST7789_HEIGHT - 1;
+        RENDER_FlushBand(y, y1);
+    }
+
+    RENDER_Begin();
+}
@@ -1,6 +1,7 @@
 #include "display_st7789.h"
 #include "stm32f103xb.h"
 #include "spi.h"
+#include "dwt.h"       // delays for reset / sleep-out timing
 #include "utility.h"   // mini_printf for logging
 #include <stdint.h>
 
@@ -8,25 +9,74 @@
 // --- SPI Communication Helpers ---
 // ===============================
 
+// SPI2 at fPCLK/2, mode 3, no CS line (display always selected)
+static SPI_Handle_t st7789_spi = {
+    .SPIx   = SPI2,
+    .config = {
+        .maxClock = ST7789_SPI_MAX_CLOCK,
+        .mode     = SPI_MODE_3,
+        .bitOrder = SPI_MSB_FIRST,
+        .dataSize = SPI_DATASIZE_8BIT
+    },
+    .csPort = 0
+};
+
+// Current orientation; width/height are what the drawing code clips against
+uint16_t st7789_width  = ST7789_PANEL_WIDTH;
+uint16_t st7789_height = ST7789_PANEL_HEIGHT;
+static uint8_t st7789_rotation = ST7789_ROTATION_0;
+static uint8_t st7789_mirror = 0;
+static uint16_t st7789_xoff = 0;   // logical (0,0) → frame memory column/row
+static uint16_t st7789_yoff = 0;
+
+// Address window the controller is using and how far the write pointer
+// has moved through it; lets SetAddressWindow skip commands already in effect
+static struct {
+    uint16_t x0, y0, x1, y1;
+    uint32_t written;       // pixels sent since the last RAMWR
+    uint8_t valid;          // CASET/RASET above are what the panel holds
+    uint8_t writing;        // no other command since RAMWR/RAMWRC
+} st7789_win;
+
+static ST7789_Stats_t st7789_stats;   // bus traffic, for benchmarks
+
 // Send a command to the ST7789
 // DC pin LOW indicates this is a command
 static void ST7789_WriteCommand(uint8_t cmd) {
+    while(SPI_IsBusy(&st7789_spi));  // DC must not toggle under a running DMA fill
     ST7789_DC_LOW();     // Set DC pin low → next byte is command
-    SPI2_Transmit(cmd);  // Send the command via SPI2
+    SPI_Transmit(&st7789_spi, cmd);  // Send the command via SPI2
+    st7789_stats.commands++;
+    st7789_stats.bytes++;
+    st7789_win.writing = (cmd == 0x2C || cmd == 0x3C); // any other command ends a memory write
 }
 
 // Send a single data byte to ST7789
 // DC pin HIGH indicates this is data
 static void ST7789_WriteData(uint8_t data) {
+    while(SPI_IsBusy(&st7789_spi));
     ST7789_DC_HIGH();    // Set DC pin high → next byte is data
-    SPI2_Transmit(data); // Send the data via SPI2
+    SPI_Transmit(&st7789_spi, data); // Send the data via SPI2
+    st7789_stats.bytes++;
 }
 
 // Send multiple data bytes from a buffer
-static void ST7789_WriteDataBuffer(uint8_t *buff, uint16_t len) {
+static void ST7789_WriteDataBuffer(const uint8_t *buff, uint16_t len) {
+    while(SPI_IsBusy(&st7789_spi));
     ST7789_DC_HIGH();    // Data mode
-    for(uint16_t i=0;i<len;i++)
-        SPI2_Transmit(buff[i]);
+    SPI_Write(&st7789_spi, buff, len); // one TX-only burst
+    st7789_stats.bytes += len;
+}
+
+// Bytes, commands and pixels sent since the last ST7789_ResetStats
+void ST7789_GetStats(ST7789_Stats_t *stats) {
+    *stats = st7789_stats;
+}
+
+void ST7789_ResetStats(void) {
+    st7789_stats.commands = 0;
+    st7789_stats.bytes = 0;
+    st7789_stats.pixels = 0;
 }
 
 // ===============================
@@ -47,12 +97,19 @@ void ST7789_GPIO_Init(void) {
 // --- Reset the Display ---
 // ===============================
 
-// Hardware reset sequence for ST7789
+// Hardware reset sequence for ST7789.
+// The panel may be awake, asleep or still powering up, so no SLPIN first
+// (SLPIN/SLPOUT must be 120 ms apart): the worst case, a reset while awake,
+// takes 120 ms before the next command.
+// Needs the DWT time base; ST7789_Init sets it up.
 void ST7789_Reset(void) {
-    ST7789_RST_LOW(); // Pull RESET low
-    for(volatile int i=0;i<50000;i++); // Short delay
-    ST7789_RST_HIGH(); // Pull RESET high
-    for(volatile int i=0;i<50000;i++); // Short delay
+    st7789_win.valid = 0;    // window registers back to their defaults
+
+    while(SPI_IsBusy(&st7789_spi));
+    ST7789_RST_LOW();          // Pull RESET low
+    DWT_DelayUs(10);           // tRW: 10 us minimum pulse
+    ST7789_RST_HIGH();         // Pull RESET high
+    DWT_DelayMs(120);          // tRT: reset cancel, then sleep-in, 120 ms worst case
     mini_printf("ST7789 Reset Done\r\n");
 }
 
@@ -60,50 +117,163 @@ void ST7789_Reset(void) {
 // --- Address Window ---
 // ===============================
 
-// Set the rectangular area (x0,y0,x1,y1) where pixel data will be written
-static void ST7789_SetAddressWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+// Set the rectangular area (x0,y0,x1,y1) where pixel data will be written.
+// Only the parts that differ from the current window are sent:
+//  - same columns, write pointer already at (x0,y0) inside the open window
+//    (e.g. the next rows of a stripe) → nothing, or RAMWRC after a command
+//  - otherwise CASET and/or RASET only if they changed, then RAMWR
+void ST7789_SetAddressWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
     uint8_t data[4];
 
+    if(st7789_win.valid && x0 == st7789_win.x0 && x1 == st7789_win.x1 && y1 <= st7789_win.y1) {
+        uint16_t w = x1 - x0 + 1;
+        if(st7789_win.written % w == 0 && st7789_win.y0 + st7789_win.written / w == y0) {
+            if(!st7789_win.writing) ST7789_WriteCommand(0x3C); // RAMWRC: continue at the pointer
+            return;
+        }
+    }
+
     // Column Address Set
-    ST7789_WriteCommand(0x2A); // Column command
-    data[0] = x0 >> 8; data[1] = x0 & 0xFF; // High byte, low byte of start
-    data[2] = x1 >> 8; data[3] = x1 & 0xFF; // High byte, low byte of end
-    ST7789_WriteDataBuffer(data, 4);
+    if(!st7789_win.valid || x0 != st7789_win.x0 || x1 != st7789_win.x1) {
+        uint16_t c0 = x0 + st7789_xoff, c1 = x1 + st7789_xoff;
+        ST7789_WriteCommand(0x2A); // Column command
+        data[0] = c0 >> 8; data[1] = c0 & 0xFF; // High byte, low byte of start
+        data[2] = c1 >> 8; data[3] = c1 & 0xFF; // High byte, low byte of end
+        ST7789_WriteDataBuffer(data, 4);
+    }
 
     // Row Address Set
-    ST7789_WriteCommand(0x2B); // Row command
-    data[0] = y0 >> 8; data[1] = y0 & 0xFF;
-    data[2] = y1 >> 8; data[3] = y1 & 0xFF;
-    ST7789_WriteDataBuffer(data, 4);
+    if(!st7789_win.valid || y0 != st7789_win.y0 || y1 != st7789_win.y1) {
+        uint16_t r0 = y0 + st7789_yoff, r1 = y1 + st7789_yoff;
+        ST7789_WriteCommand(0x2B); // Row command
+        data[0] = r0 >> 8; data[1] = r0 & 0xFF;
+        data[2] = r1 >> 8; data[3] = r1 & 0xFF;
+        ST7789_WriteDataBuffer(data, 4);
+    }
 
     // Memory Write command to start writing pixel data
     ST7789_WriteCommand(0x2C);
+
+    st7789_win.x0 = x0; st7789_win.y0 = y0;
+    st7789_win.x1 = x1; st7789_win.y1 = y1;
+    st7789_win.written = 0;
+    st7789_win.valid = 1;
+}
+
+// ===============================
+// --- Orientation ---
+// ===============================
+
+// MADCTL bits
+#define ST7789_MADCTL_MY  0x80   // row order
+#define ST7789_MADCTL_MX  0x40   // column order
+#define ST7789_MADCTL_MV  0x20   // row/column exchange
+
+static const uint8_t st7789_rotation_madctl[4] = {
+    0x00,                                   // 0°
+    ST7789_MADCTL_MX | ST7789_MADCTL_MV,    // 90°
+    ST7789_MADCTL_MX | ST7789_MADCTL_MY,    // 180°
+    ST7789_MADCTL_MY | ST7789_MADCTL_MV     // 270°
+};
+
+static void ST7789_ApplyOrientation(void) {
+    uint8_t madctl = st7789_rotation_madctl[st7789_rotation];
+    uint8_t mv = madctl & ST7789_MADCTL_MV;
+
+    // With MV the logical x axis runs along frame-memory rows (MY) and y along columns (MX)
+    if(st7789_mirror & ST7789_MIRROR_X) madctl ^= mv ? ST7789_MADCTL_MY : ST7789_MADCTL_MX;
+    if(st7789_mirror & ST7789_MIRROR_Y) madctl ^= mv ? ST7789_MADCTL_MX : ST7789_MADCTL_MY;
+
+    ST7789_WriteCommand(0x36); // MADCTL
+    ST7789_WriteData(madctl);
+
+    st7789_width  = mv ? ST7789_PANEL_HEIGHT : ST7789_PANEL_WIDTH;
+    st7789_height = mv ? ST7789_PANEL_WIDTH : ST7789_PANEL_HEIGHT;
+
+    // MY reads the 320-row memory from the far end, so the visible rows start 80 in
+    uint16_t skip = (madctl & ST7789_MADCTL_MY) ? ST7789_MEM_HEIGHT - ST7789_PANEL_HEIGHT : 0;
+    st7789_xoff = mv ? skip : 0;
+    st7789_yoff = mv ? 0 : skip;
+
+    st7789_win.valid = 0;      // window registers are interpreted differently now
+}
+
+// rotation: ST7789_ROTATION_0/90/180/270, mirror: ST7789_MIRROR_X | ST7789_MIRROR_Y.
+// ST7789_WIDTH/HEIGHT follow the new orientation; existing pixels are not moved.
+void ST7789_SetRotation(uint8_t rotation, uint8_t mirror) {
+    st7789_rotation = rotation & 0x3;
+    st7789_mirror = mirror & (ST7789_MIRROR_X | ST7789_MIRROR_Y);
+    ST7789_ApplyOrientation();
+}
+
+uint8_t ST7789_GetRotation(void) {
+    return st7789_rotation;
+}
+
+uint8_t ST7789_GetMirror(void) {
+    return st7789_mirror;
 }
 
 // ===============================
 // --- Initialization ---
 // ===============================
 
+// Init sequence: command, parameter count (| ST7789_SEQ_DELAY), parameters,
+// then a delay in ms if flagged. Delays are the datasheet minimums.
+#define ST7789_SEQ_DELAY  0x80
+
+static const uint8_t st7789_init_seq[] = {
+    0x3A, 1, 0x05,                  // COLMOD: 16-bit/pixel (RGB565)
+    0x11, ST7789_SEQ_DELAY | 0, 5,  // Sleep Out: 5 ms before the next command
+    0x29, 0,                        // Display ON
+};
+
+static void ST7789_RunSequence(const uint8_t *seq, uint16_t len) {
+    const uint8_t *end = seq + len;
+    while(seq < end) {
+        uint8_t cmd = *seq++;
+        uint8_t n = *seq & ~ST7789_SEQ_DELAY;
+        uint8_t delay = *seq++ & ST7789_SEQ_DELAY;
+
+        ST7789_WriteCommand(cmd);
+        if(n) ST7789_WriteDataBuffer(seq, n);
+        seq += n;
+
+        if(delay) {
+            while(SPI_IsBusy(&st7789_spi));
+            DWT_DelayMs(*seq++);
+        }
+    }
+}
+
 void ST7789_Init(void) {
     ST7789_GPIO_Init(); // Init DC/RESET pins
-    SPI2_Init();        // Init SPI2 peripheral
+    SPI_Init(&st7789_spi); // Init SPI2 peripheral + pins
+    DWT_Init();         // time base for the reset / sleep-out delays
     ST7789_Reset();     // Reset display
 
-    // Memory Data Access Control
-    ST7789_WriteCommand(0x36); // MADCTL
-    ST7789_WriteData(0x00);    // RGB order, no rotation
+    ST7789_ApplyOrientation(); // MADCTL (kept across re-inits)
+    ST7789_RunSequence(st7789_init_seq, sizeof(st7789_init_seq));
+    mini_printf("ST7789 Initialized\r\n");
+}
 
-    // Color mode setup
-    ST7789_WriteCommand(0x3A); // COLMOD
-    ST7789_WriteData(0x05);    // 16-bit/pixel (RGB565)
+// ===============================
+// --- Vertical Scrolling ---
+// ===============================
 
-    // Exit sleep mode
-    ST7789_WriteCommand(0x11); // Sleep Out
-    for(volatile int i=0;i<50000;i++); // small delay
+// VSCRDEF: top fixed rows, scrolling rows, bottom fixed rows.
+// The three must add up to the 320-row frame memory (240 visible + 80).
+void ST7789_SetScrollArea(uint16_t tfa, uint16_t vsa, uint16_t bfa) {
+    uint8_t data[6] = {tfa >> 8, tfa & 0xFF, vsa >> 8, vsa & 0xFF, bfa >> 8, bfa & 0xFF};
+    ST7789_WriteCommand(0x33); // VSCRDEF
+    ST7789_WriteDataBuffer(data, 6);
+}
 
-    // Turn display ON
-    ST7789_WriteCommand(0x29); // Display ON
-    mini_printf("ST7789 Initialized\r\n");
+// VSCSAD: frame-memory row shown at the top of the scrolling area
+void ST7789_SetScrollStart(uint16_t line) {
+    uint8_t data[2] = {line >> 8, line & 0xFF};
+    ST7789_WriteCommand(0x37); // VSCSAD
+    ST7789_WriteDataBuffer(data, 2);
 }
 
 // ===============================
@@ -117,6 +287,44 @@ void ST7789_DrawPixel(uint16_t x, uint16_t y, uint16_t color) {
     ST7789_SetAddressWindow(x, y, x, y); // set window to a single pixel
     uint8_t data[2] = {color >> 8, color & 0xFF}; // convert 16-bit color to 2 bytes
     ST7789_WriteDataBuffer(data, 2); // write pixel
+    st7789_win.written++;
+    st7789_stats.pixels++;
+}
+
+// ===============================
+// --- Write Pixels ---
+// ===============================
+
+// Stream 'n' RGB565 pixels into the current address window.
+// SPI2 runs with 16-bit frames so each pixel is one back-to-back DR write.
+void ST7789_WritePixels(const uint16_t *px, uint32_t n) {
+    if(n == 0) return;
+    while(SPI_IsBusy(&st7789_spi));
+
+    ST7789_DC_HIGH();                          // pixel data
+    SPI_SetDataSize(&st7789_spi, SPI_DATASIZE_16BIT);
+    SPI_TransmitBuffer16(&st7789_spi, px, n);
+    st7789_win.written += n;
+    st7789_stats.pixels += n;
+    st7789_stats.bytes += 2 * n;
+    SPI_SetDataSize(&st7789_spi, SPI_DATASIZE_8BIT);  // commands are 8-bit frames
+}
+
+// Default completion hook for async fills started without a callback
+static void ST7789_FillDone(void) {}
+
+// Repeat one colour 'count' times into the current window by DMA.
+// callback == 0 → blocking.
+static void ST7789_FillPixels(uint16_t color, uint32_t count, ST7789_Callback_t callback) {
+    SPI_Claim(&st7789_spi);           // waits for a running fill; no queued transfer under DC
+    ST7789_DC_HIGH();                 // pixel data
+    uint8_t status = SPI_FillDMA(&st7789_spi, color, count, callback);
+    SPI_Release(&st7789_spi);         // a running fill keeps the queue off by itself
+    if(status != SPI_OK) return;      // bus taken from an IRQ: nothing was sent
+
+    st7789_win.written += count;
+    st7789_stats.pixels += count;
+    st7789_stats.bytes += 2 * count;
 }
 
 // ===============================
@@ -128,21 +336,397 @@ void ST7789_FillScreen(uint16_t color) {
     ST7789_FillRect(0, 0, ST7789_WIDTH, ST7789_HEIGHT, color);
 }
 
+// Same as ST7789_FillScreen but returns immediately; callback runs when done
+void ST7789_FillScreenAsync(uint16_t color, ST7789_Callback_t callback) {
+    ST7789_FillRectAsync(0, 0, ST7789_WIDTH, ST7789_HEIGHT, color, callback);
+}
+
 // ===============================
 // --- Fill Rectangle ---
 // ===============================
 
-// Fill a rectangle area with a specific color
-void ST7789_FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
-    if(x >= ST7789_WIDTH || y >= ST7789_HEIGHT) return;
+#define ST7789_FILL_DMA_MIN  32   // fills below this many pixels skip the DMA setup
+
+// Clamp the rectangle to the panel and open its address window.
+// Returns the number of pixels to send (0 if fully off-screen).
+static uint32_t ST7789_PrepareRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    if(x >= ST7789_WIDTH || y >= ST7789_HEIGHT || w == 0 || h == 0) return 0;
     if(x + w > ST7789_WIDTH) w = ST7789_WIDTH - x;   // clamp width
     if(y + h > ST7789_HEIGHT) h = ST7789_HEIGHT - y; // clamp height
 
     ST7789_SetAddressWindow(x, y, x + w - 1, y + h - 1); // set pixel window
+    return (uint32_t)w * h;
+}
+
+// Fill a rectangle area with a specific color.
+// Pixels are streamed by DMA1 CH5 from a single colour word; blocks until done.
+// Small areas (line spans, dots) are cheaper to send from the CPU.
+void ST7789_FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    uint32_t count = ST7789_PrepareRect(x, y, w, h);
+    if(count == 0) return;
+
+    if(count < ST7789_FILL_DMA_MIN) {
+        uint16_t px[ST7789_FILL_DMA_MIN];
+        for(uint32_t i = 0; i < count; i++) px[i] = color;
+        ST7789_WritePixels(px, count);
+        return;
+    }
+
+    ST7789_FillPixels(color, count, 0);
+}
+
+// Non-blocking fill: the CPU is free while DMA streams the pixels.
+// Any later draw call waits for the fill to finish; use ST7789_IsBusy() to poll.
+void ST7789_FillRectAsync(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, ST7789_Callback_t callback) {
+    uint32_t count = ST7789_PrepareRect(x, y, w, h);
+    if(count == 0) {
+        if(callback) callback();
+        return;
+    }
+
+    ST7789_FillPixels(color, count, callback ? callback : ST7789_FillDone);
+}
+
+uint8_t ST7789_IsBusy(void) {
+    return SPI_IsBusy(&st7789_spi);
+}
+
+// ===============================
+// --- Draw Image (RLE) ---
+// ===============================
+
+#define ST7789_IMAGE_BUF         64  // short runs are gathered here before sending
+#define ST7789_IMAGE_FILL_MIN    32  // runs this long go out as a DMA fill
+#define ST7789_IMAGE_DIRECT_MIN  16  // literals this long stream straight from flash
+
+typedef struct {
+    uint16_t col;            // column inside the image row
+    uint16_t w;              // image width
+    uint16_t visW;           // columns inside the panel
+    uint32_t left;           // visible pixels still to send
+    uint8_t n;               // pixels waiting in buf
+    uint16_t buf[ST7789_IMAGE_BUF];
+} ST7789_ImageOut_t;
+
+static void ST7789_ImageFlush(ST7789_ImageOut_t *out) {
+    if(out->n) ST7789_WritePixels(out->buf, out->n);
+    out->n = 0;
+}
+
+// Send 'count' visible pixels: px != 0 → literal pixels, else 'color' repeated
+static void ST7789_ImageEmit(ST7789_ImageOut_t *out, uint16_t color, const uint16_t *px, uint32_t count) {
+    if(count == 0) return;
+
+    if(px ? (count >= ST7789_IMAGE_DIRECT_MIN) : (count >= ST7789_IMAGE_FILL_MIN)) {
+        ST7789_ImageFlush(out);
+        if(px) {
+            ST7789_WritePixels(px, count);
+        } else {
+            ST7789_FillPixels(color, count, 0);
+        }
+        return;
+    }
+
+    while(count--) {
+        out->buf[out->n++] = px ? *px++ : color;
+        if(out->n == ST7789_IMAGE_BUF) ST7789_ImageFlush(out);
+    }
+}
+
+// Walk one decoded span through the image rows, dropping clipped columns
+static void ST7789_ImageSpan(ST7789_ImageOut_t *out, uint16_t color, const uint16_t *px, uint32_t count) {
+    while(count && out->left) {
+        uint32_t seg, vis;
+
+        if(out->visW == out->w) {
+            // Whole rows are visible: the window takes the span as-is
+            seg = vis = (count < out->left) ? count : out->left;
+        } else {
+            seg = out->w - out->col;
+            if(seg > count) seg = count;
+            vis = 0;
+            if(out->col < out->visW) {
+                vis = out->visW - out->col;
+                if(vis > seg) vis = seg;
+            }
+            out->col += seg;
+            if(out->col == out->w) out->col = 0;
+        }
+
+        ST7789_ImageEmit(out, color, px, vis);
+        out->left -= vis;
+        count -= seg;
+        if(px) px += seg;
+    }
+}
+
+// Decode an RLE image into one address window at (x,y), clipped to the panel.
+// No frame buffer: runs become DMA fills or buffered bursts as they are read.
+void ST7789_DrawImage(uint16_t x, uint16_t y, const ST7789_Image_t *img) {
+    static ST7789_ImageOut_t out;
+    if(!img || x >= ST7789_WIDTH || y >= ST7789_HEIGHT || img->width == 0 || img->height == 0) return;
+
+    uint16_t visW = (x + img->width > ST7789_WIDTH) ? ST7789_WIDTH - x : img->width;
+    uint16_t visH = (y + img->height > ST7789_HEIGHT) ? ST7789_HEIGHT - y : img->height;
+
+    out.col  = 0;
+    out.w    = img->width;
+    out.visW = visW;
+    out.left = (uint32_t)visW * visH;
+    out.n    = 0;
+
+    ST7789_SetAddressWindow(x, y, x + visW - 1, y + visH - 1);
+
+    uint32_t i = 0;
+    while(i < img->length && out.left) {
+        uint16_t token = img->data[i++];
+        uint32_t count = (token & ST7789_RLE_COUNT) + 1;
+
+        if(token & ST7789_RLE_RUN) {
+            if(i >= img->length) break;              // truncated data
+            ST7789_ImageSpan(&out, img->data[i++], 0, count);
+        } else {
+            if(i + count > img->length) break;
+            ST7789_ImageSpan(&out, 0, &img->data[i], count);
+            i += count;
+        }
+    }
+
+    ST7789_ImageFlush(&out);
+}
+
+// ===============================
+// --- Draw Sprite ---
+// ===============================
+
+// Palette index of pixel i in a packed row
+static uint8_t ST7789_SpriteIndex(const uint8_t *row, uint8_t bpp, uint16_t i) {
+    uint32_t bit = (uint32_t)i * bpp;
+    uint8_t shift = 8 - bpp - (bit & 7);
+    return (row[bit >> 3] >> shift) & ((1 << bpp) - 1);
+}
+
+// Draw a sprite at (x,y); may start off-screen to the left/top.
+// Opaque pixels are sent as horizontal runs. Each run's window reaches down
+// to the last visible row, so a run with the same columns on the next row
+// continues in it (the window cache sends nothing) and unkeyed or
+// rectangular sprites cost a single window.
+void ST7789_DrawSprite(int16_t x, int16_t y, const ST7789_Sprite_t *spr) {
+    static uint16_t line[ST7789_MAX_SIDE];
+    if(!spr || spr->width == 0 || spr->height == 0) return;
+    if(spr->bpp != 16 && spr->bpp != 8 && spr->bpp != 4 && spr->bpp != 2 && spr->bpp != 1) return;
+
+    // Visible part in sprite coordinates: columns [c0,c1), rows [r0,r1)
+    int16_t c0 = (x < 0) ? -x : 0;
+    int16_t r0 = (y < 0) ? -y : 0;
+    int16_t c1 = (x + spr->width > ST7789_WIDTH) ? ST7789_WIDTH - x : spr->width;
+    int16_t r1 = (y + spr->height > ST7789_HEIGHT) ? ST7789_HEIGHT - y : spr->height;
+    if(c0 >= c1 || r0 >= r1) return;
+
+    uint32_t stride = (spr->bpp == 16) ? spr->width * 2u : ((uint32_t)spr->width * spr->bpp + 7) / 8;
+    uint8_t keyed = spr->flags & ST7789_SPRITE_KEYED;
+
+    for(int16_t r = r0; r < r1; r++) {
+        const uint8_t *row = (const uint8_t *)spr->pixels + r * stride;
+        const uint16_t *row16 = (const uint16_t *)row;
+
+        int16_t c = c0;
+        while(c < c1) {
+            // Skip transparent pixels, then measure the opaque run
+            if(keyed) {
+                if(spr->bpp == 16) { while(c < c1 && row16[c] == spr->key) c++; }
+                else { while(c < c1 && ST7789_SpriteIndex(row, spr->bpp, c) == spr->key) c++; }
+                if(c == c1) break;
+            }
+
+            int16_t start = c;
+            if(!keyed) c = c1;
+            else if(spr->bpp == 16) { while(c < c1 && row16[c] != spr->key) c++; }
+            else { while(c < c1 && ST7789_SpriteIndex(row, spr->bpp, c) != spr->key) c++; }
+
+            ST7789_SetAddressWindow(x + start, y + r, x + c - 1, y + r1 - 1);
+
+            if(spr->bpp == 16) {
+                ST7789_WritePixels(&row16[start], c - start);   // straight from flash
+            } else {
+                for(int16_t i = start; i < c; i++)
+                    line[i - start] = spr->palette[ST7789_SpriteIndex(row, spr->bpp, i)];
+                ST7789_WritePixels(line, c - start);
+            }
+        }
+    }
+}
+
+// ===============================
+// --- 2D Primitives ---
+// ===============================
+// Every shape is broken into horizontal or vertical spans, and each span is
+// one address window, so no primitive pays a window setup per pixel.
+
+// Span with signed coordinates, clipped to the panel
+static void ST7789_Span(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    if(x < 0) { w += x; x = 0; }
+    if(y < 0) { h += y; y = 0; }
+    if(w <= 0 || h <= 0 || x >= ST7789_WIDTH || y >= ST7789_HEIGHT) return;
+    ST7789_FillRect(x, y, w > ST7789_WIDTH ? ST7789_WIDTH : w, h > ST7789_HEIGHT ? ST7789_HEIGHT : h, color);
+}
+
+void ST7789_DrawHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    ST7789_Span(x, y, w, 1, color);
+}
+
+void ST7789_DrawVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    ST7789_Span(x, y, 1, h, color);
+}
+
+// Bresenham line. Pixels that share a row (shallow lines) or a column
+// (steep lines) are sent as one span instead of one window each.
+void ST7789_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    int32_t dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+    int32_t dy = (y1 > y0) ? y1 - y0 : y0 - y1;
+    int16_t sx = (x0 < x1) ? 1 : -1;
+    int16_t sy = (y0 < y1) ? 1 : -1;
+    uint8_t shallow = dx >= dy;
+    int32_t err = dx - dy;
+    int16_t rx = x0, ry = y0;   // start of the current run
+
+    while(1) {
+        uint8_t last = (x0 == x1 && y0 == y1);
+        int16_t nx = x0, ny = y0;
+        if(!last) {
+            int32_t e2 = 2 * err;
+            if(e2 > -dy) { err -= dy; nx += sx; }
+            if(e2 < dx)  { err += dx; ny += sy; }
+        }
+
+        // Run ends when the line leaves its row/column (or at the end point)
+        if(last || (shallow ? ny != y0 : nx != x0)) {
+            if(shallow) ST7789_Span(rx < x0 ? rx : x0, y0, (rx > x0 ? rx - x0 : x0 - rx) + 1, 1, color);
+            else        ST7789_Span(x0, ry < y0 ? ry : y0, 1, (ry > y0 ? ry - y0 : y0 - ry) + 1, color);
+            rx = nx; ry = ny;
+        }
+        if(last) break;
+        x0 = nx; y0 = ny;
+    }
+}
+
+// Midpoint circle walked over one octant (x = 0..y). Points with the same y
+// form a group [xs, xe]; 'fill' selects filled rows instead of the outline.
+// The shape is a circle stretched to the box (cx0..cx1, cy0..cy1), which
+// gives rounded rectangles with straight edges between the corner arcs.
+static void ST7789_RoundShape(int16_t cx0, int16_t cy0, int16_t cx1, int16_t cy1, int16_t r, uint8_t fill, uint16_t color) {
+    int16_t x = 0, y = r, xs = 0;
+    int32_t d = 1 - r;
+
+    if(fill) ST7789_Span(cx0 - r, cy0, cx1 - cx0 + 2 * r + 1, cy1 - cy0 + 1, color); // middle block
+
+    while(x <= y) {
+        // Filled rows at distance x (x = 0 is the middle block)
+        if(fill && x > 0) {
+            ST7789_Span(cx0 - y, cy0 - x, cx1 - cx0 + 2 * y + 1, 1, color);
+            ST7789_Span(cx0 - y, cy1 + x, cx1 - cx0 + 2 * y + 1, 1, color);
+        }
+
+        int16_t nx = x + 1, ny = y;
+        if(d < 0) d += 2 * x + 3;
+        else { d += 2 * (x - y) + 5; ny--; }
+
+        if(ny != y || nx > ny) {
+            int16_t xe = x, len = xe - xs + 1;
+            if(fill) {
+                // Rows at distance y, unless the x rows above already covered them
+                if(y > xe) {
+                    ST7789_Span(cx0 - xe, cy0 - y, cx1 - cx0 + 2 * xe + 1, 1, color);
+                    ST7789_Span(cx0 - xe, cy1 + y, cx1 - cx0 + 2 * xe + 1, 1, color);
+                }
+            } else if(xs == 0) {
+                // Group touching the axis: the straight edges join both corners
+                ST7789_Span(cx0 - xe, cy0 - y, cx1 - cx0 + 2 * xe + 1, 1, color);
+                ST7789_Span(cx0 - xe, cy1 + y, cx1 - cx0 + 2 * xe + 1, 1, color);
+                ST7789_Span(cx0 - y, cy0 - xe, 1, cy1 - cy0 + 2 * xe + 1, color);
+                ST7789_Span(cx1 + y, cy0 - xe, 1, cy1 - cy0 + 2 * xe + 1, color);
+            } else {
+                // Four horizontal runs (top/bottom) and four vertical runs (sides)
+                ST7789_Span(cx0 - xe, cy0 - y, len, 1, color);
+                ST7789_Span(cx1 + xs, cy0 - y, len, 1, color);
+                ST7789_Span(cx0 - xe, cy1 + y, len, 1, color);
+                ST7789_Span(cx1 + xs, cy1 + y, len, 1, color);
+                ST7789_Span(cx0 - y, cy0 - xe, 1, len, color);
+                ST7789_Span(cx1 + y, cy0 - xe, 1, len, color);
+                ST7789_Span(cx0 - y, cy1 + xs, 1, len, color);
+                ST7789_Span(cx1 + y, cy1 + xs, 1, len, color);
+            }
+            xs = nx;
+        }
+        x = nx; y = ny;
+    }
+}
+
+void ST7789_DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    if(r < 0) return;
+    ST7789_RoundShape(x0, y0, x0, y0, r, 0, color);
+}
+
+void ST7789_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    if(r < 0) return;
+    ST7789_RoundShape(x0, y0, x0, y0, r, 1, color);
+}
 
-    uint8_t data[2] = {color >> 8, color & 0xFF};
-    for(uint32_t i=0;i<w*h;i++)
-        ST7789_WriteDataBuffer(data, 2); // fill each pixel
+// Corner radius is limited so the arcs' centres do not cross
+static int16_t ST7789_ClampRadius(int16_t w, int16_t h, int16_t r) {
+    int16_t max = (((w < h) ? w : h) - 1) / 2;
+    if(r > max) r = max;
+    return (r < 0) ? 0 : r;
+}
+
+void ST7789_DrawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+    if(w <= 0 || h <= 0) return;
+    r = ST7789_ClampRadius(w, h, r);
+    ST7789_RoundShape(x + r, y + r, x + w - 1 - r, y + h - 1 - r, r, 0, color);
+}
+
+void ST7789_FillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+    if(w <= 0 || h <= 0) return;
+    r = ST7789_ClampRadius(w, h, r);
+    ST7789_RoundShape(x + r, y + r, x + w - 1 - r, y + h - 1 - r, r, 1, color);
+}
+
+void ST7789_DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    ST7789_DrawLine(x0, y0, x1, y1, color);
+    ST7789_DrawLine(x1, y1, x2, y2, color);
+    ST7789_DrawLine(x2, y2, x0, y0, color);
+}
+
+// Scanline fill: one horizontal span per row
+void ST7789_FillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    int16_t t;
+    // Sort by y: y0 <= y1 <= y2
+    if(y0 > y1) { t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t; }
+    if(y1 > y2) { t = y1; y1 = y2; y2 = t; t = x1; x1 = x2; x2 = t; }
+    if(y0 > y1) { t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t; }
+
+    if(y0 == y2) {  // flat: a single span
+        int16_t a = x0, b = x0;
+        if(x1 < a) a = x1;
+        if(x1 > b) b = x1;
+        if(x2 < a) a = x2;
+        if(x2 > b) b = x2;
+        ST7789_Span(a, y0, b - a + 1, 1, color);
+        return;
+    }
+
+    int32_t dx01 = x1 - x0, dy01 = y1 - y0;
+    int32_t dx02 = x2 - x0, dy02 = y2 - y0;
+    int32_t dx12 = x2 - x1, dy12 = y2 - y1;
+
+    for(int16_t y = (y0 < 0) ? 0 : y0; y <= y2 && y < ST7789_HEIGHT; y++) {
+        // Long edge 0→2 against the short edge (0→1 above y1, 1→2 below)
+        int32_t a = x0 + dx02 * (y - y0) / dy02;
+        int32_t b = (y < y1) ? x0 + dx01 * (y - y0) / dy01
+                  : (dy12 ? x1 + dx12 * (y - y1) / dy12 : x1);
+        if(a > b) { int32_t s = a; a = b; b = s; }
+        ST7789_Span(a, y, b - a + 1, 1, color);
+    }
 }
 
 // ===============================
@@ -215,25 +799,73 @@ static const uint8_t Font5x7[][5] = {
     {0x00,0x41,0x41,0x7F,0x00}, // ']' 93
     {0x04,0x02,0x01,0x02,0x04}, // '^' 94
     {0x40,0x40,0x40,0x40,0x40}, // '_' 95
-    {0x00,0x01,0x02,0x04,0x00} // '`' 96
+    {0x00,0x01,0x02,0x04,0x00}, // '`' 96
+    {0x20,0x54,0x54,0x54,0x78}, // 'a' 97
+    {0x7F,0x48,0x44,0x44,0x38}, // 'b' 98
+    {0x38,0x44,0x44,0x44,0x20}, // 'c' 99
+    {0x38,0x44,0x44,0x48,0x7F}, // 'd' 100
+    {0x38,0x54,0x54,0x54,0x18}, // 'e' 101
+    {0x08,0x7E,0x09,0x01,0x02}, // 'f' 102
+    {0x0C,0x52,0x52,0x52,0x3E}, // 'g' 103
+    {0x7F,0x08,0x04,0x04,0x78}, // 'h' 104
+    {0x00,0x44,0x7D,0x40,0x00}, // 'i' 105
+    {0x20,0x40,0x44,0x3D,0x00}, // 'j' 106
+    {0x7F,0x10,0x28,0x44,0x00}, // 'k' 107
+    {0x00,0x41,0x7F,0x40,0x00}, // 'l' 108
+    {0x7C,0x04,0x18,0x04,0x78}, // 'm' 109
+    {0x7C,0x08,0x04,0x04,0x78}, // 'n' 110
+    {0x38,0x44,0x44,0x44,0x38}, // 'o' 111
+    {0x7C,0x14,0x14,0x14,0x08}, // 'p' 112
+    {0x08,0x14,0x14,0x18,0x7C}, // 'q' 113
+    {0x7C,0x08,0x04,0x04,0x08}, // 'r' 114
+    {0x48,0x54,0x54,0x54,0x20}, // 's' 115
+    {0x04,0x3F,0x44,0x40,0x20}, // 't' 116
+    {0x3C,0x40,0x40,0x20,0x7C}, // 'u' 117
+    {0x1C,0x20,0x40,0x20,0x1C}, // 'v' 118
+    {0x3C,0x40,0x30,0x40,0x3C}, // 'w' 119
+    {0x44,0x28,0x10,0x28,0x44}, // 'x' 120
+    {0x0C,0x50,0x50,0x50,0x3C}, // 'y' 121
+    {0x44,0x64,0x54,0x4C,0x44}, // 'z' 122
+    {0x00,0x08,0x36,0x41,0x00}, // '{' 123
+    {0x00,0x00,0x7F,0x00,0x00}, // '|' 124
+    {0x00,0x41,0x36,0x08,0x00}, // '}' 125
+    {0x10,0x08,0x08,0x10,0x08} // '~' 126
 };
 
+#define FONT5X7_FIRST  32
+#define FONT5X7_COUNT  (sizeof(Font5x7) / sizeof(Font5x7[0]))
+
+// Column bitmap (5 bytes, bit0 = top row) for c, or 0 if not in the table
+const uint8_t *ST7789_GetGlyph(char c) {
+    uint8_t idx = (uint8_t)c - FONT5X7_FIRST;
+    if((uint8_t)c < FONT5X7_FIRST || idx >= FONT5X7_COUNT) return 0;
+    return Font5x7[idx];
+}
+
 // ===============================
 // --- Draw Character (5x7) ---
 // ===============================
 
+// One 6x8 address window per character (5 glyph columns + 1 spacing column),
+// expanded into a small pixel buffer and sent in a single burst.
 void ST7789_DrawChar(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg) {
-    if(c < 32 || c > 127) return; // ignore non-printable characters
-    const uint8_t *bitmap = Font5x7[c - 32]; // get char bitmap
-
-    // Draw 5x7 pixels for character
-    for(uint8_t i=0;i<5;i++) {
-        uint8_t line = bitmap[i];
-        for(uint8_t j=0;j<8;j++) { // 7 rows + 1 extra bit
-            ST7789_DrawPixel(x+i, y+j, (line & 0x1) ? color : bg);
-            line >>= 1; // next row
-        }
+    if(x >= ST7789_WIDTH || y >= ST7789_HEIGHT) return;
+    const uint8_t *bitmap = ST7789_GetGlyph(c); // get char bitmap
+    if(!bitmap) return;                          // ignore non-printable characters
+
+    uint8_t w = (x + 6 > ST7789_WIDTH) ? ST7789_WIDTH - x : 6;   // clip at edges
+    uint8_t h = (y + 8 > ST7789_HEIGHT) ? ST7789_HEIGHT - y : 8;
+
+    // Window fills row by row: walk rows outside, glyph columns inside
+    uint16_t pixels[6 * 8];
+    uint16_t *p = pixels;
+    for(uint8_t row=0; row<h; row++) {          // 7 rows + 1 extra bit
+        for(uint8_t col=0; col<w; col++)
+            *p++ = (col < 5 && ((bitmap[col] >> row) & 0x1)) ? color : bg;
     }
+
+    ST7789_SetAddressWindow(x, y, x + w - 1, y + h - 1);
+    ST7789_WritePixels(pixels, (uint32_t)w * h);
 }
 
 // ===============================
@@ -251,33 +883,74 @@ void ST7789_DrawString(uint16_t x, uint16_t y, const char *str, uint16_t color,
 }
 
 // ===============================
-// --- Draw Character Scaled ---
+// --- Draw Text Run Scaled ---
 // ===============================
 
-void ST7789_DrawCharScaled(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg, uint8_t scale) {
-    if(c < 32 || c > 127) return;
-    const uint8_t *bitmap = Font5x7[c - 32];
-
-    for(uint8_t col = 0; col < 5; col++) {
-        uint8_t bits = bitmap[col];
-        for(uint8_t row = 0; row < 7; row++) {
-            uint16_t fill = (bits & (1 << row)) ? color : bg;
-            // Fill a block of 'scale x scale' pixels
-            ST7789_FillRect(x + col*scale, y + row*scale, scale, scale, fill);
+// Draw 'n' characters on one line with a single address window covering the
+// whole run. Each font row is expanded horizontally into a RAM line buffer
+// once and then sent 'scale' times. Unknown characters become blank cells.
+// Never wraps: the run is clipped at the panel edge.
+void ST7789_DrawRunScaled(uint16_t x, uint16_t y, const char *str, uint16_t n, uint16_t color, uint16_t bg, uint8_t scale) {
+    static uint16_t line[ST7789_MAX_SIDE];
+    if(x >= ST7789_WIDTH || y >= ST7789_HEIGHT || n == 0 || scale == 0) return;
+
+    uint16_t w = n * 6 * scale;
+    uint16_t h = 8 * scale;
+    if(x + w > ST7789_WIDTH) w = ST7789_WIDTH - x;   // clamp width
+    if(y + h > ST7789_HEIGHT) h = ST7789_HEIGHT - y; // clamp height
+
+    ST7789_SetAddressWindow(x, y, x + w - 1, y + h - 1);
+
+    for(uint8_t row = 0; row < 8 && h; row++) {
+        // Expand this font row across the run
+        uint16_t *p = line;
+        uint16_t left = w;
+        for(uint16_t i = 0; i < n && left; i++) {
+            const uint8_t *bitmap = ST7789_GetGlyph(str[i]);
+            for(uint8_t col = 0; col < 6 && left; col++) {
+                uint16_t fill = (bitmap && col < 5 && ((bitmap[col] >> row) & 0x1)) ? color : bg;
+                for(uint8_t r = 0; r < scale && left; r++, left--) *p++ = fill;
+            }
         }
+
+        // Same line buffer for every pixel row of this font row
+        for(uint8_t r = 0; r < scale && h; r++, h--)
+            ST7789_WritePixels(line, w);
     }
 }
 
+// ===============================
+// --- Draw Character Scaled ---
+// ===============================
+
+void ST7789_DrawCharScaled(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg, uint8_t scale) {
+    if(!ST7789_GetGlyph(c)) return;
+    ST7789_DrawRunScaled(x, y, &c, 1, color, bg, scale);
+}
+
 // ===============================
 // --- Draw String Scaled ---
 // ===============================
 
+// Characters are grouped into one run per text line so each line of the
+// string costs one address window.
 void ST7789_DrawStringScaled(uint16_t x, uint16_t y, const char *str, uint16_t color, uint16_t bg, uint8_t scale) {
     while(*str) {
-        ST7789_DrawCharScaled(x, y, *str, color, bg, scale);
-        x += 6 * scale; // move to next char
-        str++;
-        if(x + 5*scale >= ST7789_WIDTH) { x = 0; y += 8*scale; } // line wrap
+        // Collect the characters that fit before the line wraps
+        uint16_t n = 0;
+        uint16_t nx = x;
+        uint8_t wrap = 0;
+        while(str[n]) {
+            n++;
+            nx += 6 * scale; // move to next char
+            if(nx + 5*scale >= ST7789_WIDTH) { wrap = 1; break; } // line wrap
+        }
+
+        ST7789_DrawRunScaled(x, y, str, n, color, bg, scale);
+        str += n;
+
+        if(!wrap) break;
+        x = 0; y += 8*scale;
         if(y + 7*scale >= ST7789_HEIGHT) break;                  // bottom of screen
     }
 }
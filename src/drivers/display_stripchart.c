@@ -0,0 +1,179 @@
+#include "display_stripchart.h"
+#include <stdint.h>
+
+// One line of the plot (a column, or a row in rotation-0 scroll mode)
+static uint16_t unit[ST7789_MAX_SIDE];
+
+static const uint16_t strip_default_colors[STRIP_MAX_CHANNELS] = {
+    ST7789_COLOR_YELLOW, ST7789_COLOR_CYAN, ST7789_COLOR_MAGENTA, ST7789_COLOR_GREEN
+};
+
+// ===============================
+// --- Line Composition ---
+// ===============================
+
+// Pixel offset of a value along the value axis (0 = min)
+static uint16_t STRIP_Level(const STRIP_t *s, int16_t v) {
+    if(v <= s->min) return 0;
+    if(v >= s->max) return s->span - 1;
+    return (uint16_t)(((int32_t)(v - s->min) * (s->span - 1)) / (s->max - s->min));
+}
+
+// Columns draw larger values higher up; rows draw them further right
+static uint16_t STRIP_Index(const STRIP_t *s, uint16_t level) {
+    return s->rows ? level : s->span - 1 - level;
+}
+
+// Background, grid and (if 'traces') the segment from the previous sample
+// to the one in 'slot' for every channel. 'tick' places the time grid.
+static void STRIP_Compose(const STRIP_t *s, uint16_t slot, uint32_t tick, uint8_t traces, uint8_t has_prev) {
+    uint16_t fill = (s->grid && tick % s->grid == 0) ? s->grid_color : s->bg;
+    for(uint16_t i = 0; i < s->span; i++) unit[i] = fill;
+    if(s->grid) {
+        for(uint16_t lv = 0; lv < s->span; lv += s->grid) unit[STRIP_Index(s, lv)] = s->grid_color;
+    }
+    if(!traces) return;
+
+    uint16_t prev_slot = (slot == 0) ? s->len - 1 : slot - 1;
+    for(uint8_t c = 0; c < s->channels; c++) {
+        uint16_t a = STRIP_Index(s, STRIP_Level(s, s->samples[slot][c]));
+        uint16_t b = has_prev ? STRIP_Index(s, STRIP_Level(s, s->samples[prev_slot][c])) : a;
+        if(a > b) { uint16_t t = a; a = b; b = t; }
+        for(uint16_t i = a; i <= b; i++) unit[i] = s->color[c];
+    }
+}
+
+// Send the composed line to ring slot 'slot' on screen
+static void STRIP_WriteSlot(const STRIP_t *s, uint16_t slot) {
+    if(s->rows) ST7789_SetAddressWindow(s->x, s->y + slot, s->x + s->w - 1, s->y + slot);
+    else        ST7789_SetAddressWindow(s->x + slot, s->y, s->x + slot, s->y + s->h - 1);
+    ST7789_WritePixels(unit, s->span);
+}
+
+// Frame-memory line where the ring starts (scroll mode)
+static uint16_t STRIP_ScrollBase(const STRIP_t *s) {
+    return s->rows ? s->y : s->x;
+}
+
+// ===============================
+// --- Setup ---
+// ===============================
+
+// Scroll mode needs rotation 0 or 90 without mirroring (frame-memory rows then
+// run along y or x with no offset) and a band across the whole panel.
+uint8_t STRIP_Init(STRIP_t *s, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t channels, STRIP_Mode_t mode) {
+    if(channels == 0 || channels > STRIP_MAX_CHANNELS) return STRIP_ERR;
+    if(x + w > ST7789_WIDTH || y + h > ST7789_HEIGHT || w < 2 || h < 2) return STRIP_ERR;
+
+    s->rows = 0;
+    if(mode == STRIP_SCROLL) {
+        uint8_t rot = ST7789_GetRotation();
+        if(ST7789_GetMirror()) return STRIP_ERR;
+        if(rot == ST7789_ROTATION_0 && x == 0 && w == ST7789_WIDTH) s->rows = 1;
+        else if(!(rot == ST7789_ROTATION_90 && y == 0 && h == ST7789_HEIGHT)) return STRIP_ERR;
+    } else if(w <= STRIP_SWEEP_GAP + 1) {
+        return STRIP_ERR;
+    }
+
+    s->x = x; s->y = y; s->w = w; s->h = h;
+    s->mode = mode;
+    s->channels = channels;
+    s->len = s->rows ? h : w;
+    s->span = s->rows ? w : h;
+    s->min = 0;
+    s->max = 4095;                          // 12-bit ADC
+    s->bg = ST7789_COLOR_BLACK;
+    s->grid_color = ST7789_COLOR_BLACK;
+    s->grid = 0;
+    for(uint8_t c = 0; c < STRIP_MAX_CHANNELS; c++) s->color[c] = strip_default_colors[c];
+
+    if(mode == STRIP_SCROLL) {
+        uint16_t base = STRIP_ScrollBase(s);
+        ST7789_SetScrollArea(base, s->len, ST7789_MEM_HEIGHT - base - s->len);
+    }
+
+    STRIP_Clear(s);
+    return STRIP_OK;
+}
+
+// Takes effect on new samples; call STRIP_Redraw to repaint the history
+void STRIP_SetStyle(STRIP_t *s, uint16_t bg, uint16_t grid_color, uint8_t grid) {
+    s->bg = bg;
+    s->grid_color = grid_color;
+    s->grid = grid;
+}
+
+void STRIP_SetChannelColor(STRIP_t *s, uint8_t channel, uint16_t color) {
+    if(channel < STRIP_MAX_CHANNELS) s->color[channel] = color;
+}
+
+// Rescales the stored history as well
+uint8_t STRIP_SetRange(STRIP_t *s, int16_t min, int16_t max) {
+    if(min >= max) return STRIP_ERR;
+    s->min = min;
+    s->max = max;
+    STRIP_Redraw(s);
+    return STRIP_OK;
+}
+
+// ===============================
+// --- Samples ---
+// ===============================
+
+// One value per channel. Sweep: the new column plus the gap column ahead of
+// it. Scroll: the new line goes into the oldest slot, then VSCSAD moves it
+// to the end of the band.
+void STRIP_Add(STRIP_t *s, const int16_t *values) {
+    uint16_t slot = s->head;
+    uint16_t visible = (s->mode == STRIP_SWEEP) ? s->len - STRIP_SWEEP_GAP : s->len;
+
+    for(uint8_t c = 0; c < s->channels; c++) s->samples[slot][c] = values[c];
+    uint8_t has_prev = s->count > 0;
+    if(s->count < visible) s->count++;
+
+    uint32_t tick = (s->mode == STRIP_SWEEP) ? slot : s->total;
+    STRIP_Compose(s, slot, tick, 1, has_prev);
+    STRIP_WriteSlot(s, slot);
+
+    s->head = (slot + 1 == s->len) ? 0 : slot + 1;
+    s->total++;
+
+    if(s->mode == STRIP_SWEEP) {
+        uint16_t gap = (slot + STRIP_SWEEP_GAP) % s->len;
+        STRIP_Compose(s, gap, gap, 0, 0);
+        STRIP_WriteSlot(s, gap);
+    } else {
+        ST7789_SetScrollStart(STRIP_ScrollBase(s) + s->head);
+    }
+}
+
+void STRIP_Clear(STRIP_t *s) {
+    s->head = 0;
+    s->count = 0;
+    s->total = 0;
+    STRIP_Redraw(s);
+}
+
+// Repaint every slot from the ring (after a style/range change or when
+// something else drew over the plot)
+void STRIP_Redraw(STRIP_t *s) {
+    for(uint16_t slot = 0; slot < s->len; slot++) {
+        // Age 0 = newest sample; slots older than 'count' are blank
+        uint16_t age = (s->head + s->len - 1 - slot) % s->len;
+        uint8_t traces = age < s->count;
+        uint32_t tick;
+
+        if(s->mode == STRIP_SWEEP) tick = slot;
+        else if(traces)            tick = s->total - 1 - age;
+        else                       tick = s->total + (slot + s->len - s->head) % s->len;
+
+        // The oldest sample's predecessor is still in the ring in sweep mode
+        // (under the gap); in scroll mode the newest sample has replaced it.
+        uint8_t has_prev = age + 1 < s->count || (s->mode == STRIP_SWEEP && s->total > s->count);
+
+        STRIP_Compose(s, slot, tick, traces, has_prev);
+        STRIP_WriteSlot(s, slot);
+    }
+
+    if(s->mode == STRIP_SCROLL) ST7789_SetScrollStart(STRIP_ScrollBase(s) + s->head);
+}
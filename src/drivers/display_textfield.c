@@ -0,0 +1,59 @@
+#include "display_textfield.h"
+#include "utility.h"   // mini_vsnprintf
+
+void TEXTFIELD_Init(TEXTFIELD_t *tf, uint16_t x, uint16_t y, uint8_t scale) {
+    tf->x = x;
+    tf->y = y;
+    tf->scale = scale ? scale : 1;
+    tf->drawn = 0;
+}
+
+// Forget the cached cells (e.g. after the screen was cleared): next Set redraws all
+void TEXTFIELD_Invalidate(TEXTFIELD_t *tf) {
+    tf->drawn = 0;
+}
+
+// Draw cells [start, end) of the cache as one text run. No wrapping: cells
+// past the panel edge are clipped, never drawn at x = 0 on the next line.
+static void TEXTFIELD_DrawRun(TEXTFIELD_t *tf, uint8_t start, uint8_t end) {
+    ST7789_DrawRunScaled(tf->x + start * 6 * tf->scale, tf->y, &tf->text[start], end - start,
+                         tf->color[start], tf->bg[start], tf->scale);
+}
+
+// Show 'str'. Cells left over from a longer previous text are blanked with bg.
+void TEXTFIELD_Set(TEXTFIELD_t *tf, const char *str, uint16_t color, uint16_t bg) {
+    uint8_t len = 0;
+    while(str[len] && len < TEXTFIELD_MAX_CHARS) len++;
+    uint8_t total = (len > tf->drawn) ? len : tf->drawn;
+
+    uint8_t run_start = 0, in_run = 0;
+    for(uint8_t i = 0; i <= total; i++) {
+        uint8_t dirty = 0;
+
+        if(i < total) {
+            char c = (i < len) ? str[i] : ' ';
+            dirty = (i >= tf->drawn) || tf->text[i] != c || tf->color[i] != color || tf->bg[i] != bg;
+            if(dirty) {
+                tf->text[i] = c;
+                tf->color[i] = color;
+                tf->bg[i] = bg;
+            }
+        }
+
+        // A run shares one colour pair, so it only breaks on clean cells
+        if(dirty && !in_run) { run_start = i; in_run = 1; }
+        if(!dirty && in_run) { TEXTFIELD_DrawRun(tf, run_start, i); in_run = 0; }
+    }
+
+    tf->drawn = total;
+}
+
+void TEXTFIELD_printf(TEXTFIELD_t *tf, uint16_t color, uint16_t bg, const char *fmt, ...) {
+    char buf[TEXTFIELD_MAX_CHARS + 1];
+    va_list args;
+    va_start(args, fmt);
+    mini_vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+
+    TEXTFIELD_Set(tf, buf, color, bg);
+}
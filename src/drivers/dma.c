@@ -0,0 +1,107 @@
+#include "dma.h"
+
+// ---------------- Helper: channel registers ----------------
+static DMA_Channel_TypeDef* DMA_GetChannel(DMA_Channel_t ch) {
+    switch(ch) {
+        case DMA_CH1: return DMA1_Channel1;
+        case DMA_CH2: return DMA1_Channel2;
+        case DMA_CH3: return DMA1_Channel3;
+        case DMA_CH4: return DMA1_Channel4;
+        case DMA_CH5: return DMA1_Channel5;
+        case DMA_CH6: return DMA1_Channel6;
+        case DMA_CH7: return DMA1_Channel7;
+        default: return 0;
+    }
+}
+
+// IRQ numbers are contiguous: DMA1_Channel1_IRQn .. DMA1_Channel7_IRQn
+#define DMA_IRQN(ch)        ((IRQn_Type)(DMA1_Channel1_IRQn + (ch) - 1))
+// Each channel owns 4 flag bits in ISR/IFCR: GIF, TCIF, HTIF, TEIF
+#define DMA_FLAG_SHIFT(ch)  (((ch) - 1) * 4)
+
+// ---------------- Callback storage ----------------
+static DMA_Callback_t dma_callbacks[8] = {0};
+
+// ---------------- Init ----------------
+void DMA_Init(void) {
+    RCC->AHBENR |= RCC_AHBENR_DMA1EN; // Enable DMA1 clock
+}
+
+// ---------------- Start a transfer ----------------
+// config: DMA_MEM_TO_PERIPH / DMA_MINC / DMA_SIZE_16BIT / DMA_CIRCULAR ... OR-ed together
+// TC and TE interrupts are enabled whenever a callback is given
+void DMA_Start(DMA_Channel_t ch, volatile void *periph, const void *mem, uint16_t count,
+               uint32_t config, DMA_Callback_t callback) {
+    DMA_Channel_TypeDef *chan = DMA_GetChannel(ch);
+    if (!chan) return;
+
+    DMA_Init();
+
+    chan->CCR &= ~DMA_CCR_EN;                           // Channel must be off to reprogram
+    DMA1->IFCR = 0xFUL << DMA_FLAG_SHIFT(ch);           // Clear stale flags
+
+    dma_callbacks[ch] = callback;
+
+    chan->CPAR  = (uint32_t)periph;
+    chan->CMAR  = (uint32_t)mem;
+    chan->CNDTR = count;
+    chan->CCR   = config;
+
+    if (callback) {
+        chan->CCR |= DMA_CCR_TCIE | DMA_CCR_TEIE;
+        NVIC_EnableIRQ(DMA_IRQN(ch));
+    }
+
+    chan->CCR |= DMA_CCR_EN;
+}
+
+// ---------------- Stop / status ----------------
+void DMA_Stop(DMA_Channel_t ch) {
+    DMA_Channel_TypeDef *chan = DMA_GetChannel(ch);
+    if (!chan) return;
+
+    chan->CCR &= ~(DMA_CCR_EN | DMA_CCR_TCIE | DMA_CCR_HTIE | DMA_CCR_TEIE);
+    DMA1->IFCR = 0xFUL << DMA_FLAG_SHIFT(ch);
+}
+
+uint8_t DMA_IsBusy(DMA_Channel_t ch) {
+    DMA_Channel_TypeDef *chan = DMA_GetChannel(ch);
+    if (!chan) return 0;
+    return (chan->CCR & DMA_CCR_EN) && chan->CNDTR;
+}
+
+uint16_t DMA_GetRemaining(DMA_Channel_t ch) {
+    DMA_Channel_TypeDef *chan = DMA_GetChannel(ch);
+    if (!chan) return 0;
+    return (uint16_t)chan->CNDTR;
+}
+
+// ---------------- IRQ dispatch ----------------
+static void DMA_IRQHandler(DMA_Channel_t ch) {
+    uint32_t shift = DMA_FLAG_SHIFT(ch);
+    uint32_t isr = (DMA1->ISR >> shift) & 0xF;
+    DMA1->IFCR = isr << shift;                          // Clear what we are handling
+
+    uint8_t events = 0;
+    if (isr & (DMA_ISR_TCIF1 >> DMA_ISR_GIF1_Pos)) events |= DMA_EVENT_TC;
+    if (isr & (DMA_ISR_HTIF1 >> DMA_ISR_GIF1_Pos)) events |= DMA_EVENT_HT;
+    if (isr & (DMA_ISR_TEIF1 >> DMA_ISR_GIF1_Pos)) events |= DMA_EVENT_TE;
+
+    // One-shot transfers are finished: release the channel
+    DMA_Channel_TypeDef *chan = DMA_GetChannel(ch);
+    if ((events & DMA_EVENT_TE) || ((events & DMA_EVENT_TC) && !(chan->CCR & DMA_CCR_CIRC)))
+        chan->CCR &= ~DMA_CCR_EN;
+
+    if (events && dma_callbacks[ch]) dma_callbacks[ch](events);
+}
+
+#define DMA_IRQ_HANDLER(IRQ, CH) \
+void IRQ(void) { DMA_IRQHandler(CH); }
+
+DMA_IRQ_HANDLER(DMA1_Channel1_IRQHandler, DMA_CH1)
+DMA_IRQ_HANDLER(DMA1_Channel2_IRQHandler, DMA_CH2)
+DMA_IRQ_HANDLER(DMA1_Channel3_IRQHandler, DMA_CH3)
+DMA_IRQ_HANDLER(DMA1_Channel4_IRQHandler, DMA_CH4)
+DMA_IRQ_HANDLER(DMA1_Channel5_IRQHandler, DMA_CH5)
+DMA_IRQ_HANDLER(DMA1_Channel6_IRQHandler, DMA_CH6)
+DMA_IRQ_HANDLER(DMA1_Channel7_IRQHandler, DMA_CH7)
@@ -0,0 +1,50 @@
+#include "dwt.h"
+#include "system_stm32f1xx.h"
+
+/**
+ * @brief Enable the cycle counter (keeps counting if already running)
+ */
+void DWT_Init(void)
+{
+    SystemCoreClockUpdate();                      // delays are derived from HCLK
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+}
+
+/**
+ * @brief Current cycle count; wraps every 2^32 HCLK cycles (~60 s at 72 MHz)
+ */
+uint32_t DWT_GetCycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief Convert a cycle difference to microseconds at the current HCLK
+ */
+uint32_t DWT_CyclesToUs(uint32_t cycles)
+{
+    return cycles / (SystemCoreClock / 1000000U);
+}
+
+/**
+ * @brief Busy-wait at least 'us' microseconds, independent of optimisation level
+ */
+void DWT_DelayUs(uint32_t us)
+{
+    uint32_t start = DWT->CYCCNT;
+    uint32_t ticks = us * (SystemCoreClock / 1000000U);
+    while ((DWT->CYCCNT - start) < ticks);
+}
+
+/**
+ * @brief Busy-wait at least 'ms' milliseconds
+ */
+void DWT_DelayMs(uint32_t ms)
+{
+    while (ms--) DWT_DelayUs(1000);
+}
@@ -0,0 +1,110 @@
+#include "log.h"
+#include "uart.h"
+
+// ---------------- Ring ----------------
+// A record is a header word (ID in the low half, argument count above it)
+// followed by its argument words
+#define LOG_MASK        (LOG_BUFFER_WORDS - 1)
+#define LOG_FRAME_MAX   (4 + 4 * LOG_MAX_ARGS + 1)
+
+static uint32_t log_ring[LOG_BUFFER_WORDS];
+static volatile uint16_t log_head = 0;      // next free word (writers)
+static volatile uint16_t log_tail = 0;      // oldest unsent word (LOG_Process)
+static volatile uint32_t log_dropped = 0;   // not yet in the ring
+static uint32_t log_dropped_total = 0;
+static USART_TypeDef *log_uart = 0;
+
+void LOG_Init(USART_TypeDef *USARTx) {
+    log_uart = USARTx;
+    log_head = log_tail = 0;
+    log_dropped = 0;
+    log_dropped_total = 0;
+}
+
+static uint16_t LOG_Room(void) {
+    return LOG_BUFFER_WORDS - (uint16_t)(log_head - log_tail);
+}
+
+// The drop count as a record of its own, so the decoder shows the gap
+// where records went missing (IRQs masked)
+static void LOG_PushDropped(void) {
+    uint16_t head = log_head;
+    log_ring[head++ & LOG_MASK] = LOG_ID_DROPPED | (1UL << 16);
+    log_ring[head++ & LOG_MASK] = log_dropped;
+    log_head = head;
+    log_dropped = 0;
+}
+
+// Append one record after any pending drop count (IRQs masked)
+static uint8_t LOG_Push(uint16_t id, uint8_t nargs, const uint32_t *args) {
+    if (LOG_Room() < nargs + 1U + (log_dropped ? 2U : 0U)) return 0;
+    if (log_dropped) LOG_PushDropped();
+
+    uint16_t head = log_head;
+    log_ring[head++ & LOG_MASK] = id | ((uint32_t)nargs << 16);
+    for (uint8_t i = 0; i < nargs; i++) log_ring[head++ & LOG_MASK] = args[i];
+    log_head = head;
+    return 1;
+}
+
+// A full ring drops the new record and counts it
+void LOG_Write(uint16_t id, uint8_t nargs, const uint32_t *args) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (!LOG_Push(id, nargs, args)) {
+        log_dropped++;
+        log_dropped_total++;
+    }
+    __set_PRIMASK(primask);
+}
+
+// ---------------- Output ----------------
+static void LOG_SendFrame(uint16_t id, uint8_t nargs, uint16_t first) {
+    uint8_t frame[LOG_FRAME_MAX];
+    uint8_t len = 0;
+
+    frame[len++] = LOG_FRAME_SYNC;
+    frame[len++] = nargs;
+    frame[len++] = (uint8_t)id;
+    frame[len++] = (uint8_t)(id >> 8);
+    for (uint8_t i = 0; i < nargs; i++) {
+        uint32_t v = log_ring[(uint16_t)(first + i) & LOG_MASK];
+        frame[len++] = (uint8_t)v;
+        frame[len++] = (uint8_t)(v >> 8);
+        frame[len++] = (uint8_t)(v >> 16);
+        frame[len++] = (uint8_t)(v >> 24);
+    }
+
+    uint8_t sum = 0;
+    for (uint8_t i = 1; i < len; i++) sum += frame[i];
+    frame[len++] = sum;
+
+    UART_Write(log_uart, frame, len);
+}
+
+// Sends every record queued so far. Only the main loop may call it: the
+// tail is advanced without locking.
+void LOG_Process(void) {
+    if (!log_uart) return;
+
+    while (log_tail != log_head) {
+        uint16_t tail = log_tail;
+        uint32_t header = log_ring[tail & LOG_MASK];
+        uint8_t nargs = (uint8_t)(header >> 16);
+
+        LOG_SendFrame((uint16_t)header, nargs, tail + 1);
+        log_tail = tail + 1 + nargs;                // frees the words for writers
+    }
+
+    // Losses after the last record: report them now
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint8_t marker = log_dropped && LOG_Room() >= 2;
+    if (marker) LOG_PushDropped();
+    __set_PRIMASK(primask);
+    if (marker) LOG_Process();
+}
+
+uint32_t LOG_GetDropped(void) {
+    return log_dropped_total;
+}
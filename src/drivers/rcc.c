@@ -29,3 +29,68 @@ void RCC_DisableClock(RCC_Bus_t bus, uint32_t peripheral) {
             break;
     }
 }
+
+// AHB clock (HCLK): SYSCLK source, PLL factors and HPRE decoded by CMSIS
+uint32_t RCC_GetHCLKFreq(void) {
+    SystemCoreClockUpdate();
+    return SystemCoreClock;
+}
+
+// APB1 clock (PCLK1): HCLK / PPRE1
+uint32_t RCC_GetPCLK1Freq(void) {
+    uint32_t ppre1 = (RCC->CFGR & RCC_CFGR_PPRE1) >> RCC_CFGR_PPRE1_Pos;
+    return RCC_GetHCLKFreq() >> APBPrescTable[ppre1];
+}
+
+// APB2 clock (PCLK2): HCLK / PPRE2
+uint32_t RCC_GetPCLK2Freq(void) {
+    uint32_t ppre2 = (RCC->CFGR & RCC_CFGR_PPRE2) >> RCC_CFGR_PPRE2_Pos;
+    return RCC_GetHCLKFreq() >> APBPrescTable[ppre2];
+}
+
+// ---------------- PLL ----------------
+#define RCC_HSE_TIMEOUT  0x10000U
+
+// Flash needs 2 wait states above 48 MHz; APB1 is limited to 36 MHz.
+// On an HSE timeout the clock stays on HSI and RCC_ERR is returned.
+uint8_t RCC_SetSysClockPLL(RCC_PLLSource_t source) {
+    uint32_t pll;
+
+    if (source == RCC_PLL_HSI) {
+        pll = RCC_CFGR_PLLMULL16;                       // PLLSRC = 0: HSI/2
+    } else {
+        if (source == RCC_PLL_HSE_BYPASS) RCC->CR |= RCC_CR_HSEBYP;
+        else                              RCC->CR &= ~RCC_CR_HSEBYP;
+        RCC->CR |= RCC_CR_HSEON;
+
+        uint32_t timeout = RCC_HSE_TIMEOUT;
+        while (!(RCC->CR & RCC_CR_HSERDY)) {
+            if (--timeout == 0) {
+                RCC->CR &= ~RCC_CR_HSEON;
+                return RCC_ERR;
+            }
+        }
+        pll = RCC_CFGR_PLLSRC | RCC_CFGR_PLLMULL9;      // PLLXTPRE = 0: HSE/1
+    }
+
+    // Back to HSI while the PLL is reprogrammed
+    RCC->CFGR &= ~RCC_CFGR_SW;
+    while ((RCC->CFGR & RCC_CFGR_SWS) != RCC_CFGR_SWS_HSI);
+    RCC->CR &= ~RCC_CR_PLLON;
+    while (RCC->CR & RCC_CR_PLLRDY);
+
+    FLASH->ACR = FLASH_ACR_PRFTBE | FLASH_ACR_LATENCY_2;
+
+    RCC->CFGR = (RCC->CFGR & ~(RCC_CFGR_PLLSRC | RCC_CFGR_PLLXTPRE | RCC_CFGR_PLLMULL |
+                               RCC_CFGR_HPRE | RCC_CFGR_PPRE1 | RCC_CFGR_PPRE2))
+              | pll | RCC_CFGR_HPRE_DIV1 | RCC_CFGR_PPRE1_DIV2 | RCC_CFGR_PPRE2_DIV1;
+
+    RCC->CR |= RCC_CR_PLLON;
+    while (!(RCC->CR & RCC_CR_PLLRDY));
+
+    RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_SW) | RCC_CFGR_SW_PLL;
+    while ((RCC->CFGR & RCC_CFGR_SWS) != RCC_CFGR_SWS_PLL);
+
+    SystemCoreClockUpdate();
+    return RCC_OK;
+}
@@ -1,112 +1,507 @@
 #include "spi.h"
+#include "rcc.h"
+
+// ------------------- Per-bus state -------------------
+typedef struct {
+    SPI_TypeDef *SPIx;
+    DMA_Channel_t txDma;
+    DMA_Channel_t rxDma;
+    IRQn_Type irqn;
+    volatile uint8_t busy;              // DMA fill or queued transaction running
+    volatile uint8_t held;              // blocking transfers / SPI_Begin frames in progress
+
+    // DMA fill
+    SPI_Handle_t *fillOwner;
+    volatile uint16_t fillValue;
+    volatile uint32_t fillRemaining;
+    SPI_Callback_t fillCallback;
+
+    // Transaction queue
+    SPI_Transaction_t *head;            // running (when busy) then pending
+    SPI_Transaction_t *tail;
+    uint16_t index;                     // next byte in interrupt mode
+    uint8_t dummyTx;                    // 0xFF clocked out when txBuf == 0
+    uint8_t dummyRx;                    // sink when rxBuf == 0
+} SPI_Bus_t;
+
+static SPI_Bus_t spi_bus[2] = {
+    { .SPIx = SPI1, .txDma = DMA_CH3, .rxDma = DMA_CH2, .irqn = SPI1_IRQn, .dummyTx = 0xFF },
+    { .SPIx = SPI2, .txDma = DMA_CH5, .rxDma = DMA_CH4, .irqn = SPI2_IRQn, .dummyTx = 0xFF },
+};
+
+static SPI_Bus_t* SPI_GetBus(SPI_TypeDef *SPIx) {
+    return (SPIx == SPI1) ? &spi_bus[0] : &spi_bus[1];
+}
 
 // ------------------- GPIO Init -------------------
-void SPI1_GPIO_Init(void) {
-    RCC->APB2ENR |= RCC_APB2ENR_IOPAEN;  // Enable GPIOA clock
-    RCC->APB2ENR |= RCC_APB2ENR_SPI1EN;  // Enable SPI1 clock
+static void SPI_ConfigGPIO(SPI_TypeDef *SPIx) {
+    if (SPIx == SPI1) {
+        RCC->APB2ENR |= RCC_APB2ENR_IOPAEN;  // Enable GPIOA clock
+        RCC->APB2ENR |= RCC_APB2ENR_SPI1EN;  // Enable SPI1 clock
+
+        // PA5-SCK (AF PP 50MHz)
+        GPIOA->CRL &= ~(0xF << (5*4));
+        GPIOA->CRL |= 0xB << (5*4);
+
+        // PA6-MISO (Floating input)
+        GPIOA->CRL &= ~(0xF << (6*4));
+        GPIOA->CRL |= 0x4 << (6*4);
+
+        // PA7-MOSI (AF PP 50MHz)
+        GPIOA->CRL &= ~(0xF << (7*4));
+        GPIOA->CRL |= 0xB << (7*4);
+    } else if (SPIx == SPI2) {
+        RCC->APB2ENR |= RCC_APB2ENR_IOPBEN;  // Enable GPIOB clock
+        RCC->APB1ENR |= RCC_APB1ENR_SPI2EN;  // Enable SPI2 clock
+
+        // PB13-SCK (AF PP 50MHz)
+        GPIOB->CRH &= ~(0xF << ((13-8)*4));
+        GPIOB->CRH |= 0xB << ((13-8)*4);
+
+        // PB14-MISO (Floating input)
+        GPIOB->CRH &= ~(0xF << ((14-8)*4));
+        GPIOB->CRH |= 0x4 << ((14-8)*4);
+
+        // PB15-MOSI (AF PP 50MHz)
+        GPIOB->CRH &= ~(0xF << ((15-8)*4));
+        GPIOB->CRH |= 0xB << ((15-8)*4);
+    }
+}
+
+// Chip select: output push-pull 50MHz, idle high
+static void SPI_ConfigCS(SPI_Handle_t *hspi) {
+    if (!hspi->csPort) return;
 
-    // PA5-SCK (AF PP 50MHz)
-    GPIOA->CRL &= ~(0xF << (5*4));
-    GPIOA->CRL |= 0xB << (5*4);
+    if (hspi->csPort == GPIOA) RCC->APB2ENR |= RCC_APB2ENR_IOPAEN;
+    if (hspi->csPort == GPIOB) RCC->APB2ENR |= RCC_APB2ENR_IOPBEN;
+    if (hspi->csPort == GPIOC) RCC->APB2ENR |= RCC_APB2ENR_IOPCEN;
 
-    // PA6-MISO (Floating input)
-    GPIOA->CRL &= ~(0xF << (6*4));
-    GPIOA->CRL |= 0x4 << (6*4);
+    hspi->csPort->BSRR = (1 << hspi->csPin);
+    volatile uint32_t *reg = (hspi->csPin < 8) ? &hspi->csPort->CRL : &hspi->csPort->CRH;
+    uint32_t shift = (hspi->csPin % 8) * 4;
+    *reg &= ~(0xF << shift);
+    *reg |= 0x3 << shift;
+}
+
+// ------------------- Clock -------------------
+static uint32_t SPI_GetPCLK(SPI_TypeDef *SPIx) {
+    return (SPIx == SPI1) ? RCC_GetPCLK2Freq() : RCC_GetPCLK1Freq();
+}
+
+// Smallest divider (2^(BR+1)) that keeps SCK at or below maxClock
+static uint16_t SPI_CalcBaudRate(uint32_t pclk, uint32_t maxClock) {
+    uint16_t br = 0;
+    if (maxClock == 0) return 0;
+    while (br < 7 && (pclk >> (br + 1)) > maxClock) br++;
+    return br;
+}
+
+// ------------------- CR1 handling -------------------
+static uint16_t SPI_BuildCR1(SPI_Handle_t *hspi) {
+    uint16_t cr1 = SPI_CR1_MSTR | SPI_CR1_SSM | SPI_CR1_SSI;  // Master, software NSS
 
-    // PA7-MOSI (AF PP 50MHz)
-    GPIOA->CRL &= ~(0xF << (7*4));
-    GPIOA->CRL |= 0xB << (7*4);
+    cr1 |= SPI_CalcBaudRate(SPI_GetPCLK(hspi->SPIx), hspi->config.maxClock) << SPI_CR1_BR_Pos;
+    if (hspi->config.mode & 0x2) cr1 |= SPI_CR1_CPOL;
+    if (hspi->config.mode & 0x1) cr1 |= SPI_CR1_CPHA;
+    if (hspi->config.bitOrder == SPI_LSB_FIRST) cr1 |= SPI_CR1_LSBFIRST;
+    if (hspi->config.dataSize == SPI_DATASIZE_16BIT) cr1 |= SPI_CR1_DFF;
+    return cr1;
 }
 
-void SPI2_GPIO_Init(void) {
-    RCC->APB2ENR |= RCC_APB2ENR_IOPBEN;  // Enable GPIOB clock
-    RCC->APB1ENR |= RCC_APB1ENR_SPI2EN;  // Enable SPI2 clock
+// Load a CR1 value; BR/CPOL/CPHA/DFF may only change while SPE=0
+static void SPI_WriteCR1(SPI_TypeDef *SPIx, uint16_t cr1) {
+    if (SPIx->CR1 == (uint32_t)(cr1 | SPI_CR1_SPE)) return;
 
-    // PB13-SCK (AF PP 50MHz)
-    GPIOB->CRH &= ~(0xF << ((13-8)*4));
-    GPIOB->CRH |= 0xB << ((13-8)*4);
+    while (SPIx->SR & SPI_SR_BSY) {}
+    SPIx->CR1 = cr1;
+    SPIx->CR1 = cr1 | SPI_CR1_SPE;
+}
 
-    // PB14-MISO (Floating input)
-    GPIOB->CRH &= ~(0xF << ((14-8)*4));
-    GPIOB->CRH |= 0x4 << ((14-8)*4);
+static void SPI_QueueKick(SPI_Bus_t *bus);
 
-    // PB15-MOSI (AF PP 50MHz)
-    GPIOB->CRH &= ~(0xF << ((15-8)*4));
-    GPIOB->CRH |= 0xB << ((15-8)*4);
+// Mask IRQs once no fill or transaction is running, so the caller can take
+// the bus before the queue starts anything; the caller restores *primask.
+// wait == 0 → returns 0 with IRQs as they were instead of waiting.
+static uint8_t SPI_Lock(SPI_Bus_t *bus, uint8_t wait, uint32_t *primask) {
+    *primask = __get_PRIMASK();
+    __disable_irq();
+    while (bus->busy) {
+        __set_PRIMASK(*primask);        // let the running transfer's IRQs finish it
+        if (!wait) return 0;
+        __disable_irq();
+    }
+    return 1;
+}
+
+// Take the bus: wait for the running fill or transaction, then hold the
+// queue until SPI_Release so nothing queued from an IRQ can rewrite CR1 or
+// assert its CS in the middle. Nests (SPI_Begin, blocking transfers).
+void SPI_Claim(SPI_Handle_t *hspi) {
+    SPI_Bus_t *bus = SPI_GetBus(hspi->SPIx);
+    uint32_t primask;
+    SPI_Lock(bus, 1, &primask);
+    bus->held++;
+    __set_PRIMASK(primask);
+    SPI_WriteCR1(hspi->SPIx, hspi->cr1);
+}
+
+// Transactions queued while the bus was held start here
+void SPI_Release(SPI_Handle_t *hspi) {
+    SPI_Bus_t *bus = SPI_GetBus(hspi->SPIx);
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (bus->held && --bus->held == 0) SPI_QueueKick(bus);
+    __set_PRIMASK(primask);
+}
+
+// Make this device's settings current on its bus
+static void SPI_Apply(SPI_Handle_t *hspi) {
+    SPI_Claim(hspi);
+    SPI_Release(hspi);
 }
 
 // ------------------- SPI Init -------------------
-void SPI1_Init(void) {
-    SPI1->CR1 = 0;
-    SPI1->CR1 |= SPI_CR1_MSTR;    // Master mode
-    SPI1->CR1 |= SPI_CR1_SSM;     // Software slave management
-    SPI1->CR1 |= SPI_CR1_SSI;     // Internal slave select
-    SPI1->CR1 &= ~SPI_CR1_BR;     // Clear baud rate
-    SPI1->CR1 |= (0x2 << 3);      // BR = fPCLK/8 → safe for ADXL345
-    SPI1->CR1 |= SPI_CR1_CPOL;    // Clock idle high
-    SPI1->CR1 |= SPI_CR1_CPHA;    // Capture on 2nd edge
-    SPI1->CR1 |= SPI_CR1_SPE;     // Enable SPI
-}
-
-
-void SPI2_Init(void) {
-    SPI2->CR1 = 0;
-    SPI2->CR1 |= SPI_CR1_MSTR;
-    SPI2->CR1 |= SPI_CR1_SSM;
-    SPI2->CR1 |= SPI_CR1_SSI;
-    SPI2->CR1 |= SPI_CR1_BR_1;      // fPCLK/8
-    SPI2->CR1 |= SPI_CR1_CPOL;
-    SPI2->CR1 |= SPI_CR1_CPHA;
-    SPI2->CR1 |= SPI_CR1_SPE;
+void SPI_Init(SPI_Handle_t *hspi) {
+    SPI_ConfigGPIO(hspi->SPIx);
+    SPI_ConfigCS(hspi);
+
+    hspi->cr1 = SPI_BuildCR1(hspi);
+    SPI_Apply(hspi);
 }
 
-// ------------------- Single Byte Transmit/Receive -------------------
-uint8_t SPI1_TransmitReceive(uint8_t data) {
-    uint32_t timeout = SPI1_TIMEOUT;
-    while(!(SPI1->SR & SPI_SR_TXE) && timeout--) {}
-    if(timeout == 0) return 0xFF; // timeout
+// Actual SCK frequency for this handle
+uint32_t SPI_GetClock(SPI_Handle_t *hspi) {
+    uint16_t br = (hspi->cr1 & SPI_CR1_BR) >> SPI_CR1_BR_Pos;
+    return SPI_GetPCLK(hspi->SPIx) >> (br + 1);
+}
 
-    SPI1->DR = data;
+// ------------------- Status helpers -------------------
+static uint8_t SPI_WaitFlag(SPI_TypeDef *SPIx, uint16_t flag) {
+    uint32_t timeout = SPI_DEFAULT_TIMEOUT;
+    while (!(SPIx->SR & flag)) {
+        if (--timeout == 0) return SPI_TIMEOUT;
+    }
+    return SPI_OK;
+}
 
-    timeout = SPI1_TIMEOUT;
-    while(!(SPI1->SR & SPI_SR_RXNE) && timeout--) {}
-    if(timeout == 0) return 0xFF;
+// Last frame written → TXE, then wait for the shifter to finish (BSY=0).
+// Must complete before CS or DC lines change.
+static uint8_t SPI_WaitIdle(SPI_TypeDef *SPIx) {
+    if (SPI_WaitFlag(SPIx, SPI_SR_TXE) != SPI_OK) return SPI_TIMEOUT;
 
-    return SPI1->DR;
+    uint32_t timeout = SPI_DEFAULT_TIMEOUT;
+    while (SPIx->SR & SPI_SR_BSY) {
+        if (--timeout == 0) return SPI_TIMEOUT;
+    }
+    return SPI_OK;
 }
 
-uint8_t SPI2_TransmitReceive(uint8_t data) {
-    uint32_t timeout = SPI2_TIMEOUT;
-    while(!(SPI2->SR & SPI_SR_TXE) && timeout--) {}
-    if(timeout == 0) return 0xFF;
+// TX-only bursts leave RXNE/OVR set: DR then SR read clears both
+static void SPI_ClearOverrun(SPI_TypeDef *SPIx) {
+    (void)SPIx->DR;
+    (void)SPIx->SR;
+}
 
-    SPI2->DR = data;
+// ------------------- Transaction framing -------------------
+void SPI_Begin(SPI_Handle_t *hspi) {
+    SPI_Claim(hspi);                    // held until SPI_End
+    if (hspi->csPort) hspi->csPort->BSRR = (1 << (hspi->csPin + 16));
+}
+
+void SPI_End(SPI_Handle_t *hspi) {
+    while (SPI_GetBus(hspi->SPIx)->busy) {}
+    SPI_WaitIdle(hspi->SPIx);
+    if (hspi->csPort) hspi->csPort->BSRR = (1 << hspi->csPin);
+    SPI_Release(hspi);
+}
 
-    timeout = SPI2_TIMEOUT;
-    while(!(SPI2->SR & SPI_SR_RXNE) && timeout--) {}
-    if(timeout == 0) return 0xFF;
+// ------------------- Single Byte Transmit/Receive -------------------
+// Full duplex: received byte goes to *rx (may be 0), status is returned
+uint8_t SPI_TransmitReceive(SPI_Handle_t *hspi, uint8_t data, uint8_t *rx) {
+    SPI_TypeDef *SPIx = hspi->SPIx;
+    uint8_t status = SPI_TIMEOUT;
+    SPI_Claim(hspi);
+    SPI_ClearOverrun(SPIx);             // drop anything left by a TX-only burst
 
-    return SPI2->DR;
+    if (SPI_WaitFlag(SPIx, SPI_SR_TXE) == SPI_OK) {
+        SPIx->DR = data;
+        if (SPI_WaitFlag(SPIx, SPI_SR_RXNE) == SPI_OK) {
+            uint8_t value = SPIx->DR;
+            if (rx) *rx = value;
+            status = SPI_OK;
+        }
+    }
+
+    SPI_Release(hspi);
+    return status;
 }
 
-uint8_t SPI1_Transmit(uint8_t data) { return SPI1_TransmitReceive(data); }
-uint8_t SPI2_Transmit(uint8_t data) { return SPI2_TransmitReceive(data); }
+// TX only: single byte, returns once it has left the shifter
+uint8_t SPI_Transmit(SPI_Handle_t *hspi, uint8_t data) {
+    return SPI_Write(hspi, &data, 1);
+}
 
 // ------------------- Multi-byte Transmit/Receive -------------------
-uint8_t SPI1_TransmitBuffer(uint8_t *txBuf, uint8_t *rxBuf, uint16_t len) {
+uint8_t SPI_TransmitBuffer(SPI_Handle_t *hspi, uint8_t *txBuf, uint8_t *rxBuf, uint16_t len) {
+    if (!rxBuf) return SPI_Write(hspi, txBuf, len);
+
     for(uint16_t i=0; i<len; i++) {
-        uint8_t rx = SPI1_TransmitReceive(txBuf[i]);
-        if(rx == 0xFF) return SPI_TIMEOUT;
-        rxBuf[i] = rx;
+        uint8_t status = SPI_TransmitReceive(hspi, txBuf[i], &rxBuf[i]);
+        if(status != SPI_OK) return status;
     }
     return SPI_OK;
 }
 
-uint8_t SPI2_TransmitBuffer(uint8_t *txBuf, uint8_t *rxBuf, uint16_t len) {
-    for(uint16_t i=0; i<len; i++) {
-        uint8_t rx = SPI2_TransmitReceive(txBuf[i]);
-        if(rx == 0xFF) return SPI_TIMEOUT;
-        rxBuf[i] = rx;
+// ------------------- TX-only Burst -------------------
+// Keep DR fed on TXE and never wait for RXNE: the bus runs back-to-back.
+// Received frames are discarded; the resulting OVR is cleared once at the end,
+// after BSY has dropped, so the caller may release CS/DC straight away.
+uint8_t SPI_Write(SPI_Handle_t *hspi, const uint8_t *txBuf, uint32_t len) {
+    SPI_TypeDef *SPIx = hspi->SPIx;
+    uint8_t status = SPI_OK;
+    SPI_Claim(hspi);
+
+    for (uint32_t i = 0; i < len && status == SPI_OK; i++) {
+        status = SPI_WaitFlag(SPIx, SPI_SR_TXE);
+        if (status == SPI_OK) SPIx->DR = txBuf[i];
+    }
+
+    if (status == SPI_OK) status = SPI_WaitIdle(SPIx);
+    SPI_ClearOverrun(SPIx);
+    SPI_Release(hspi);
+    return status;
+}
+
+// Same as SPI_Write with 16-bit frames (handle must be in SPI_DATASIZE_16BIT)
+uint8_t SPI_TransmitBuffer16(SPI_Handle_t *hspi, const uint16_t *txBuf, uint32_t len) {
+    SPI_TypeDef *SPIx = hspi->SPIx;
+    uint8_t status = SPI_OK;
+    SPI_Claim(hspi);
+
+    for (uint32_t i = 0; i < len && status == SPI_OK; i++) {
+        status = SPI_WaitFlag(SPIx, SPI_SR_TXE);
+        if (status == SPI_OK) SPIx->DR = txBuf[i];
+    }
+
+    if (status == SPI_OK) status = SPI_WaitIdle(SPIx);
+    SPI_ClearOverrun(SPIx);
+    SPI_Release(hspi);
+    return status;
+}
+
+// ------------------- Frame Size -------------------
+void SPI_SetDataSize(SPI_Handle_t *hspi, SPI_DataSize_t size) {
+    hspi->config.dataSize = size;
+    if (size == SPI_DATASIZE_16BIT) hspi->cr1 |= SPI_CR1_DFF;
+    else                            hspi->cr1 &= ~SPI_CR1_DFF;
+    SPI_Apply(hspi);
+}
+
+// ------------------- DMA Fill -------------------
+// The source word is not incremented, so the bus runs with 16-bit frames
+// (DFF=1) for the duration of the fill and returns to the handle's
+// frame size afterwards.
+static void SPI_FillNextChunk(SPI_Bus_t *bus);
+
+static void SPI_FillDMA_Complete(SPI_Bus_t *bus, uint8_t events) {
+    SPI_TypeDef *SPIx = bus->SPIx;
+
+    if ((events & DMA_EVENT_TC) && bus->fillRemaining) {
+        SPI_FillNextChunk(bus);
+        return;
+    }
+
+    // DMA TC only means the last word reached DR: wait for it to shift out
+    SPI_WaitIdle(SPIx);
+
+    SPIx->CR2 &= ~SPI_CR2_TXDMAEN;
+    SPI_ClearOverrun(SPIx);              // RX was ignored
+    SPI_WriteCR1(SPIx, bus->fillOwner->cr1);
+
+    bus->fillRemaining = 0;
+    bus->busy = 0;
+    if (bus->fillCallback) bus->fillCallback();
+
+    SPI_QueueKick(bus);                  // transactions queued behind the fill
+}
+
+static void SPI1_DMA_Callback(uint8_t events) { SPI_FillDMA_Complete(&spi_bus[0], events); }
+static void SPI2_DMA_Callback(uint8_t events) { SPI_FillDMA_Complete(&spi_bus[1], events); }
+
+static void SPI_FillNextChunk(SPI_Bus_t *bus) {
+    uint16_t chunk = (bus->fillRemaining > SPI_DMA_MAX_CHUNK) ? SPI_DMA_MAX_CHUNK
+                                                              : (uint16_t)bus->fillRemaining;
+    bus->fillRemaining -= chunk;
+    DMA_Start(bus->txDma, &bus->SPIx->DR, (const void *)&bus->fillValue, chunk,
+              DMA_MEM_TO_PERIPH | DMA_SIZE_16BIT | DMA_PRIO_HIGH,
+              (bus == &spi_bus[0]) ? SPI1_DMA_Callback : SPI2_DMA_Callback);
+}
+
+uint8_t SPI_FillDMA(SPI_Handle_t *hspi, uint16_t value, uint32_t count, SPI_Callback_t callback) {
+    SPI_Bus_t *bus = SPI_GetBus(hspi->SPIx);
+    uint32_t primask;
+
+    // Async → refused while busy, blocking → waits for the queue
+    if (!SPI_Lock(bus, callback == 0, &primask)) return SPI_ERR;
+    if (count == 0) {
+        __set_PRIMASK(primask);
+        if (callback) callback();
+        return SPI_OK;
+    }
+
+    bus->fillOwner     = hspi;
+    bus->fillValue     = value;
+    bus->fillRemaining = count;
+    bus->fillCallback  = callback;
+    bus->busy          = 1;             // taken before any IRQ can start the queue
+    __set_PRIMASK(primask);
+
+    SPI_WriteCR1(hspi->SPIx, hspi->cr1 | SPI_CR1_DFF);  // waits for BSY=0
+    hspi->SPIx->CR2 |= SPI_CR2_TXDMAEN;
+    SPI_FillNextChunk(bus);
+
+    if (!callback) {
+        while (bus->busy) {}
     }
     return SPI_OK;
 }
+
+uint8_t SPI_IsBusy(SPI_Handle_t *hspi) {
+    return SPI_GetBus(hspi->SPIx)->busy;
+}
+
+// ------------------- Transaction Queue -------------------
+// One FIFO per bus, advanced from interrupts only:
+//   len <  SPI_QUEUE_DMA_MIN → SPI RXNE interrupt, one byte per IRQ
+//   len >= SPI_QUEUE_DMA_MIN → RX + TX DMA, finished on RX transfer complete
+// Completing on RX (not TX) guarantees the last byte has been clocked in,
+// so CS can be released without polling BSY.
+
+// Rough busy-wait for CS setup/hold times
+static void SPI_DelayUs(uint16_t us) {
+    volatile uint32_t n = us * (SystemCoreClock / 4000000U);
+    while (n--) {}
+}
+
+static GPIO_TypeDef* SPI_TransactionCS(SPI_Transaction_t *t, uint8_t *pin) {
+    if (t->csPort) { *pin = t->csPin; return t->csPort; }
+    *pin = t->hspi->csPin;
+    return t->hspi->csPort;
+}
+
+static void SPI_QueueStart(SPI_Bus_t *bus);
+
+static void SPI_QueueFinish(SPI_Bus_t *bus, uint8_t status) {
+    SPI_TypeDef *SPIx = bus->SPIx;
+    SPI_Transaction_t *t = bus->head;
+
+    SPIx->CR2 &= ~(SPI_CR2_RXNEIE | SPI_CR2_ERRIE | SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+    DMA_Stop(bus->txDma);
+    DMA_Stop(bus->rxDma);
+    if (status != SPI_OK) SPI_ClearOverrun(SPIx);
+
+    uint8_t pin;
+    GPIO_TypeDef *cs = SPI_TransactionCS(t, &pin);
+    if (t->postDelayUs) SPI_DelayUs(t->postDelayUs);
+    if (cs) cs->BSRR = (1 << pin);
+
+    bus->head = t->next;
+    if (!bus->head) bus->tail = 0;
+    bus->busy = 0;
+
+    t->status = status;
+    if (t->callback) t->callback(t);
+
+    SPI_QueueKick(bus);
+}
+
+static void SPI_QueueDMA_Complete(SPI_Bus_t *bus, uint8_t events) {
+    SPI_QueueFinish(bus, (events & DMA_EVENT_TE) ? SPI_ERR : SPI_OK);
+}
+
+static void SPI1_RxDMA_Callback(uint8_t events) { SPI_QueueDMA_Complete(&spi_bus[0], events); }
+static void SPI2_RxDMA_Callback(uint8_t events) { SPI_QueueDMA_Complete(&spi_bus[1], events); }
+
+static void SPI_QueueStart(SPI_Bus_t *bus) {
+    SPI_TypeDef *SPIx = bus->SPIx;
+    SPI_Transaction_t *t = bus->head;
+
+    bus->busy = 1;
+    SPI_WriteCR1(SPIx, t->hspi->cr1 & ~SPI_CR1_DFF);    // queue moves bytes
+    SPI_ClearOverrun(SPIx);
+
+    uint8_t pin;
+    GPIO_TypeDef *cs = SPI_TransactionCS(t, &pin);
+    if (cs) cs->BSRR = (1 << (pin + 16));
+    if (t->preDelayUs) SPI_DelayUs(t->preDelayUs);
+
+    if (t->len == 0) {
+        SPI_QueueFinish(bus, SPI_OK);
+        return;
+    }
+
+    if (t->len >= SPI_QUEUE_DMA_MIN) {
+        // RX channel first so no received byte can be missed
+        DMA_Start(bus->rxDma, &SPIx->DR, t->rxBuf ? t->rxBuf : &bus->dummyRx, t->len,
+                  DMA_PERIPH_TO_MEM | (t->rxBuf ? DMA_MINC : 0) | DMA_PRIO_HIGH,
+                  (bus == &spi_bus[0]) ? SPI1_RxDMA_Callback : SPI2_RxDMA_Callback);
+        SPIx->CR2 |= SPI_CR2_RXDMAEN;
+        DMA_Start(bus->txDma, &SPIx->DR, t->txBuf ? t->txBuf : &bus->dummyTx, t->len,
+                  DMA_MEM_TO_PERIPH | (t->txBuf ? DMA_MINC : 0), 0);
+        SPIx->CR2 |= SPI_CR2_TXDMAEN;
+    } else {
+        bus->index = 0;
+        SPIx->CR2 |= SPI_CR2_RXNEIE | SPI_CR2_ERRIE;
+        NVIC_EnableIRQ(bus->irqn);
+        SPIx->DR = t->txBuf ? t->txBuf[0] : bus->dummyTx;
+    }
+}
+
+// Start the next pending transaction if the bus is free and not held
+static void SPI_QueueKick(SPI_Bus_t *bus) {
+    if (!bus->busy && !bus->held && bus->head) SPI_QueueStart(bus);
+}
+
+uint8_t SPI_Queue(SPI_Transaction_t *t) {
+    SPI_Bus_t *bus = SPI_GetBus(t->hspi->SPIx);
+
+    t->next   = 0;
+    t->status = SPI_PENDING;
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();                    // list is also modified from IRQs
+    if (bus->tail) bus->tail->next = t;
+    else           bus->head = t;
+    bus->tail = t;
+    SPI_QueueKick(bus);
+    __set_PRIMASK(primask);
+
+    return SPI_OK;
+}
+
+// Byte-per-interrupt mode for short transactions
+static void SPI_IRQHandler(SPI_Bus_t *bus) {
+    SPI_TypeDef *SPIx = bus->SPIx;
+    SPI_Transaction_t *t = bus->head;
+    uint32_t sr = SPIx->SR;
+
+    if (!t || !(SPIx->CR2 & SPI_CR2_RXNEIE)) return;
+
+    if (sr & (SPI_SR_OVR | SPI_SR_MODF)) {
+        SPI_QueueFinish(bus, SPI_ERR);
+        return;
+    }
+
+    if (sr & SPI_SR_RXNE) {
+        uint8_t rx = SPIx->DR;
+        if (t->rxBuf) t->rxBuf[bus->index] = rx;
+
+        if (++bus->index < t->len)
+            SPIx->DR = t->txBuf ? t->txBuf[bus->index] : bus->dummyTx;
+        else
+            SPI_QueueFinish(bus, SPI_OK);
+    }
+}
+
+void SPI1_IRQHandler(void) { SPI_IRQHandler(&spi_bus[0]); }
+void SPI2_IRQHandler(void) { SPI_IRQHandler(&spi_bus[1]); }
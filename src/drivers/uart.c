@@ -1,29 +1,100 @@
 // uart.c
 #include "uart.h"
+#include "rcc.h"
 
-// Helper: get APB clock for USARTx
-static uint32_t UART_GetClock(USART_TypeDef *USARTx) {
-    uint32_t pclk1 = 8000000UL; // default HSI
-    uint32_t pclk2 = 8000000UL;
+// ---------------- Per-USART state ----------------
+#define UART_TX_MASK  (UART_TX_BUFFER_SIZE - 1)
+#define UART_TX_DMA_CHUNK  (UART_TX_BUFFER_SIZE / 4)   // ring space comes back per chunk
+
+typedef struct {
+    USART_TypeDef *USARTx;
+    IRQn_Type irqn;
+    uint32_t baudRate;                  // as requested (UART_GetBaudError)
+    UART_TxPolicy_t txPolicy;
+    volatile uint16_t txHead;           // next free slot (writers)
+    volatile uint16_t txTail;           // oldest byte not yet sent
+    volatile uint32_t txDropped;
+    uint8_t txBuf[UART_TX_BUFFER_SIZE];
+
+    // Transmit engine: one chunk (ring run or segment) at a time
+    DMA_Channel_t txDma;
+    uint8_t txUseDma;
+    volatile uint8_t txBusy;
+    uint8_t txFromRing;                 // current chunk is ring data
+    uint16_t txChunk;                   // ring bytes in the current chunk
+    const uint8_t *txPtr;               // TXE mode progress
+    uint16_t txLeft;
+    UART_TxSegment_t *txQueue;          // pending async segments
+    UART_TxSegment_t *txQueueTail;
+
+    // DMA receive
+    DMA_Channel_t rxDma;
+    uint8_t *rxBuf;                     // 0 → DMA receive not running
+    uint16_t rxSize;
+    uint16_t rxPos;                     // DMA write index at the last sync
+    volatile uint32_t rxWritten;        // bytes received (running count)
+    volatile uint32_t rxRead;           // bytes handed out (running count)
+    volatile uint32_t rxOverruns;
+    UART_RxCallback_t rxCallback;
+} UART_Port_t;
 
-    // Determine HCLK from RCC_CFGR
-    uint32_t sws = (RCC->CFGR >> 2) & 0x3;
-    if (sws == 0) pclk2 = pclk1 = 8000000UL;      // HSI
-    else if (sws == 1) pclk2 = pclk1 = 8000000UL; // HSE 8MHz
-    else if (sws == 2) pclk2 = 72000000UL;        // PLL 72MHz
-    // APB1 prescaler
-    uint32_t ppre1 = (RCC->CFGR >> 8) & 0x7;
-    uint32_t ppre2 = (RCC->CFGR >> 11) & 0x7;
-    if (ppre1 >= 4) pclk1 >>= (ppre1 - 3);
-    if (ppre2 >= 4) pclk2 >>= (ppre2 - 3);
+static UART_Port_t uart_port[3] = {
+    { .USARTx = USART1, .irqn = USART1_IRQn, .txDma = DMA_CH4, .rxDma = DMA_CH5 },
+    { .USARTx = USART2, .irqn = USART2_IRQn, .txDma = DMA_CH7, .rxDma = DMA_CH6 },
+    { .USARTx = USART3, .irqn = USART3_IRQn, .txDma = DMA_CH2, .rxDma = DMA_CH3 },
+};
 
-    return (USARTx == USART1) ? pclk2 : pclk1;
+static UART_Port_t* UART_GetPort(USART_TypeDef *USARTx) {
+    if (USARTx == USART1) return &uart_port[0];
+    if (USARTx == USART2) return &uart_port[1];
+    return &uart_port[2];
 }
 
-// Helper: set baud rate
+// Interrupts cannot drain the ring while they are masked or while we are in
+// a handler (the USART IRQ may not preempt it); writers then poll instead
+static uint8_t UART_IrqBlocked(void) {
+    return __get_PRIMASK() || (SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk);
+}
+
+// ---------------- Baud rate ----------------
+// USART1 runs from PCLK2, USART2/3 from PCLK1 (read from the live RCC setup)
+static uint32_t UART_GetClock(USART_TypeDef *USARTx) {
+    return (USARTx == USART1) ? RCC_GetPCLK2Freq() : RCC_GetPCLK1Freq();
+}
+
+// BRR holds USARTDIV = PCLK / (16 * baud) in 12.4 fixed point: a 12-bit
+// mantissa and a fraction in 1/16ths. 16 * USARTDIV is rounded once and
+// then split, so a fraction that rounds up to 16/16 carries into the mantissa.
+// USARTDIV must be at least 1, so the fastest rate is PCLK / 16
+// (4.5 Mbaud on USART1 and 2.25 Mbaud on USART2/3 at 72 MHz); out-of-range
+// requests are clamped and show up in UART_GetBaudError.
 static void UART_SetBaudRate(USART_TypeDef *USARTx, uint32_t baudRate) {
     uint32_t pclk = UART_GetClock(USARTx);
-    USARTx->BRR = (pclk + (baudRate/2U)) / baudRate;
+    uint32_t div16 = (pclk + baudRate / 2U) / baudRate;
+
+    if (div16 < 16U) div16 = 16U;
+    if (div16 > 0xFFFFU) div16 = 0xFFFFU;
+
+    uint32_t mantissa = div16 >> 4;
+    uint32_t fraction = div16 & 0xFU;
+    USARTx->BRR = (mantissa << USART_BRR_DIV_Mantissa_Pos) | (fraction << USART_BRR_DIV_Fraction_Pos);
+}
+
+// Rate the USART actually runs at: PCLK / (16 * USARTDIV)
+uint32_t UART_GetBaudRate(USART_TypeDef *USARTx) {
+    uint32_t brr = USARTx->BRR;
+    if (brr == 0) return 0;
+    return (UART_GetClock(USARTx) + brr / 2U) / brr;
+}
+
+// Deviation of the actual rate from the one requested in UART_Init, in ppm.
+// Receivers tolerate a few percent in total (both ends together); keep each
+// side within about ±20000 ppm.
+int32_t UART_GetBaudError(USART_TypeDef *USARTx) {
+    uint32_t requested = UART_GetPort(USARTx)->baudRate;
+    if (requested == 0) return 0;
+    int64_t diff = (int64_t)UART_GetBaudRate(USARTx) - requested;
+    return (int32_t)(diff * 1000000 / requested);
 }
 
 // Helper: configure GPIO for given USART
@@ -59,6 +130,14 @@ static void UART_ConfigGPIO(USART_TypeDef *USARTx) {
 }
 
 void UART_Init(USART_TypeDef *USARTx, UART_Config_t *config) {
+    UART_Port_t *port = UART_GetPort(USARTx);
+
+    // Re-init: let queued bytes go out with the old settings
+    if (USARTx->CR1 & USART_CR1_UE) UART_Flush(USARTx);
+    port->txPolicy = config->txPolicy;
+    port->txUseDma = config->txDma;
+    port->baudRate = config->baudRate;
+
     // 1. Enable USART clock
     if (USARTx == USART1) RCC->APB2ENR |= (1 << 14);
     if (USARTx == USART2) RCC->APB1ENR |= (1 << 17);
@@ -91,20 +170,372 @@ void UART_Init(USART_TypeDef *USARTx, UART_Config_t *config) {
     if (config->enableTx) USARTx->CR1 |= (1 << 3);
     if (config->enableRx) USARTx->CR1 |= (1 << 2);
 
-    // 8. Enable USART
+    // 8. DMA requests for transmit
+    if (config->txDma) USARTx->CR3 |= USART_CR3_DMAT;
+    else               USARTx->CR3 &= ~USART_CR3_DMAT;
+
+    // 9. Enable USART; TXE interrupt is switched on by writes
     USARTx->CR1 |= (1 << 13);
+    NVIC_EnableIRQ(port->irqn);
+}
+
+// ---------------- Buffered transmit ----------------
+// The ring and the async segments form one FIFO: ring bytes written before a
+// segment was queued go first (up to its ringMark), then the segment. Each
+// step is one chunk, sent by DMA or byte by byte from the TXE interrupt.
+
+static void UART_TxKick(UART_Port_t *port);
+
+static void UART_TxSegmentDone(UART_Port_t *port) {
+    UART_TxSegment_t *seg = port->txQueue;
+    if (!seg) return;
+    port->txQueue = seg->next;
+    if (!port->txQueue) port->txQueueTail = 0;
+    seg->pending = 0;
+    if (seg->callback) seg->callback(seg);          // may queue it again
+}
+
+// Current chunk finished (interrupt context or IRQs masked)
+static void UART_TxDone(UART_Port_t *port) {
+    if (!port->txBusy) return;                      // already completed by UART_TxPoll
+    port->txBusy = 0;
+    if (port->txFromRing) port->txTail += port->txChunk;
+    else                  UART_TxSegmentDone(port);
+    port->txChunk = 0;
+    UART_TxKick(port);
+}
+
+static void UART1_TxDMA_Callback(uint8_t events) { (void)events; UART_TxDone(&uart_port[0]); }
+static void UART2_TxDMA_Callback(uint8_t events) { (void)events; UART_TxDone(&uart_port[1]); }
+static void UART3_TxDMA_Callback(uint8_t events) { (void)events; UART_TxDone(&uart_port[2]); }
+
+// Start the next chunk if the transmitter is free (IRQs masked or in an IRQ)
+static void UART_TxKick(UART_Port_t *port) {
+    while (!port->txBusy) {
+        UART_TxSegment_t *seg = port->txQueue;
+        uint16_t limit = seg ? seg->ringMark : port->txHead;
+        const uint8_t *ptr;
+        uint16_t len;
+
+        if (port->txTail != limit) {
+            // Ring bytes up to the next segment or the end of the buffer
+            uint16_t start = port->txTail & UART_TX_MASK;
+            len = (uint16_t)(limit - port->txTail);
+            if (len > UART_TX_BUFFER_SIZE - start) len = UART_TX_BUFFER_SIZE - start;
+            if (port->txUseDma && len > UART_TX_DMA_CHUNK) len = UART_TX_DMA_CHUNK;
+            ptr = &port->txBuf[start];
+            port->txFromRing = 1;
+        } else if (seg) {
+            if (seg->len == 0) {
+                UART_TxSegmentDone(port);
+                continue;
+            }
+            ptr = seg->data;
+            len = seg->len;
+            port->txFromRing = 0;
+        } else {
+            return;
+        }
+
+        port->txBusy = 1;
+        port->txChunk = port->txFromRing ? len : 0;
+        if (port->txUseDma) {
+            DMA_Callback_t cb = (port == &uart_port[0]) ? UART1_TxDMA_Callback :
+                                (port == &uart_port[1]) ? UART2_TxDMA_Callback : UART3_TxDMA_Callback;
+            DMA_Start(port->txDma, &port->USARTx->DR, ptr, len, DMA_MEM_TO_PERIPH | DMA_MINC, cb);
+        } else {
+            port->txPtr = ptr;
+            port->txLeft = len;
+            port->USARTx->CR1 |= USART_CR1_TXEIE;
+        }
+    }
+}
+
+// TXE mode: one byte per interrupt. Ring space is released byte by byte.
+static void UART_TxService(UART_Port_t *port) {
+    USART_TypeDef *USARTx = port->USARTx;
+
+    if (!port->txLeft) {
+        USARTx->CR1 &= ~USART_CR1_TXEIE;
+        return;
+    }
+
+    USARTx->DR = *port->txPtr++;
+    if (port->txFromRing) {
+        port->txTail++;
+        port->txChunk--;
+    }
+    if (--port->txLeft == 0) {
+        USARTx->CR1 &= ~USART_CR1_TXEIE;
+        UART_TxDone(port);
+    }
+}
+
+// Make progress by hand when the interrupts cannot run
+static void UART_TxPoll(UART_Port_t *port) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (!port->txBusy)
+        UART_TxKick(port);
+    else if (port->txUseDma) {
+        // TC seen, IRQ not run yet: stop the channel and clear its flags so
+        // the pending IRQ does not complete the chunk a second time
+        if (!DMA_IsBusy(port->txDma)) {
+            DMA_Stop(port->txDma);
+            UART_TxDone(port);
+        }
+    }
+    else if (port->USARTx->SR & USART_SR_TXE)
+        UART_TxService(port);
+    __set_PRIMASK(primask);
+}
+
+// OVERWRITE: drop up to 'want' of the oldest queued bytes; the rest slide
+// down over them. A DMA chunk in flight is kept, a TXE chunk is restarted.
+static uint16_t UART_TxDropOldest(UART_Port_t *port, uint16_t want) {
+    uint8_t inFlight = port->txBusy && port->txFromRing;
+    uint16_t from = port->txTail + ((inFlight && port->txUseDma) ? port->txChunk : 0);
+    uint16_t queued = port->txHead - from;
+    uint16_t n = (want < queued) ? want : queued;
+    if (n == 0) return 0;
+
+    for (uint16_t i = from; i != (uint16_t)(port->txHead - n); i++)
+        port->txBuf[i & UART_TX_MASK] = port->txBuf[(uint16_t)(i + n) & UART_TX_MASK];
+    port->txHead -= n;
+
+    // Segments keep their place relative to the surviving bytes
+    for (UART_TxSegment_t *seg = port->txQueue; seg; seg = seg->next) {
+        uint16_t rel = seg->ringMark - from;
+        seg->ringMark = (rel <= n) ? from : seg->ringMark - n;
+    }
+    if (inFlight && !port->txUseDma) {
+        port->txBusy = 0;                   // UART_Write kicks it again from txTail
+        port->txChunk = 0;
+        port->txLeft = 0;
+    }
+    port->txDropped += n;
+    return n;
+}
+
+// Copy into the ring and return; DMA or the TXE interrupt sends it.
+// Callable from interrupts: a full ring in BLOCK mode is then drained by polling.
+void UART_Write(USART_TypeDef *USARTx, const uint8_t *data, uint32_t len) {
+    UART_Port_t *port = UART_GetPort(USARTx);
+
+    while (len) {
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();                    // IRQs move txTail
+
+        uint16_t room = UART_TX_BUFFER_SIZE - (uint16_t)(port->txHead - port->txTail);
+        if (port->txPolicy == UART_TX_OVERWRITE && room < len) {
+            room += UART_TxDropOldest(port, (len > UART_TX_BUFFER_SIZE ? UART_TX_BUFFER_SIZE : len) - room);
+            if (len > room) {               // still short: keep the newest input
+                port->txDropped += len - room;
+                data += len - room;
+                len = room;
+            }
+        }
+
+        while (room && len) {
+            port->txBuf[port->txHead++ & UART_TX_MASK] = *data++;
+            room--;
+            len--;
+        }
+        UART_TxKick(port);
+        __set_PRIMASK(primask);
+
+        if (!len) break;
+        if (port->txPolicy == UART_TX_DROP) {
+            port->txDropped += len;
+            break;
+        }
+        if (UART_IrqBlocked()) UART_TxPoll(port);
+    }
 }
 
 void UART_WriteChar(USART_TypeDef *USARTx, char c) {
-    while (!(USARTx->SR & (1 << 7)));
-    USARTx->DR = (uint16_t)c;
+    UART_Write(USARTx, (const uint8_t *)&c, 1);
 }
 
 void UART_WriteString(USART_TypeDef *USARTx, const char *str) {
-    while (*str) UART_WriteChar(USARTx, *str++);
+    uint32_t len = 0;
+    while (str[len]) len++;
+    UART_Write(USARTx, (const uint8_t *)str, len);
+}
+
+// Queue caller-owned segments (seg and everything linked by seg->next) after
+// what is already buffered. The data is not copied.
+void UART_WriteAsync(USART_TypeDef *USARTx, UART_TxSegment_t *seg) {
+    UART_Port_t *port = UART_GetPort(USARTx);
+    UART_TxSegment_t *last = seg;
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    while (1) {
+        last->pending = 1;
+        last->ringMark = port->txHead;      // ring bytes before this point go first
+        if (!last->next) break;
+        last = last->next;
+    }
+    if (port->txQueueTail) port->txQueueTail->next = seg;
+    else                   port->txQueue = seg;
+    port->txQueueTail = last;
+    UART_TxKick(port);
+
+    __set_PRIMASK(primask);
+}
+
+// Wait until the ring and all queued segments have left the shifter
+// (before sleep, reset, or reconfiguring the USART)
+void UART_Flush(USART_TypeDef *USARTx) {
+    UART_Port_t *port = UART_GetPort(USARTx);
+
+    while (port->txBusy || port->txHead != port->txTail || port->txQueue) {
+        if (UART_IrqBlocked()) UART_TxPoll(port);
+    }
+    while (!(USARTx->SR & USART_SR_TC));
+}
+
+uint32_t UART_GetTxDropped(USART_TypeDef *USARTx) {
+    return UART_GetPort(USARTx)->txDropped;
+}
+
+// ---------------- DMA receive ----------------
+
+// Fold the DMA position into rxWritten. Must run at least every half buffer
+// (the HT/TC interrupts guarantee it) or a full lap would go unnoticed.
+static void UART_RxSync(UART_Port_t *port) {
+    uint16_t pos = port->rxSize - DMA_GetRemaining(port->rxDma);
+    if (pos >= port->rxSize) pos = 0;               // CNDTR reload
+    port->rxWritten += (pos >= port->rxPos) ? pos - port->rxPos : port->rxSize - port->rxPos + pos;
+    port->rxPos = pos;
+}
+
+// Unread bytes; if the DMA has lapped the reader they are gone, so skip them
+static uint32_t UART_RxAvailable(UART_Port_t *port) {
+    uint32_t avail = port->rxWritten - port->rxRead;
+    if (avail > port->rxSize) {
+        port->rxOverruns++;
+        port->rxRead = port->rxWritten;
+        avail = 0;
+    }
+    return avail;
+}
+
+// IDLE, HT or TC (interrupt context): hand new data to the callback
+static void UART_RxEvent(UART_Port_t *port) {
+    if (!port->rxBuf) return;
+    UART_RxSync(port);
+    if (!port->rxCallback) return;
+
+    uint32_t avail = UART_RxAvailable(port);
+    while (avail) {
+        uint16_t start = port->rxRead % port->rxSize;
+        uint16_t n = (avail < (uint32_t)(port->rxSize - start)) ? avail : port->rxSize - start;
+        port->rxCallback(port->USARTx, &port->rxBuf[start], n);
+        port->rxRead += n;
+        avail -= n;
+    }
 }
 
+static void UART1_RxDMA_Callback(uint8_t events) { (void)events; UART_RxEvent(&uart_port[0]); }
+static void UART2_RxDMA_Callback(uint8_t events) { (void)events; UART_RxEvent(&uart_port[1]); }
+static void UART3_RxDMA_Callback(uint8_t events) { (void)events; UART_RxEvent(&uart_port[2]); }
+
+// UART_Init with enableRx first. size up to 65535 bytes.
+void UART_StartRxDMA(USART_TypeDef *USARTx, uint8_t *buf, uint16_t size, UART_RxCallback_t callback) {
+    UART_Port_t *port = UART_GetPort(USARTx);
+    DMA_Callback_t dmaCallback = (port == &uart_port[0]) ? UART1_RxDMA_Callback :
+                                 (port == &uart_port[1]) ? UART2_RxDMA_Callback : UART3_RxDMA_Callback;
+
+    UART_StopRxDMA(USARTx);
+
+    port->rxSize = size;
+    port->rxPos = 0;
+    port->rxWritten = 0;
+    port->rxRead = 0;
+    port->rxCallback = callback;
+    port->rxBuf = buf;
+
+    (void)USARTx->SR;                                   // drop a stale byte / error
+    (void)USARTx->DR;
+    DMA_Start(port->rxDma, &USARTx->DR, buf, size,
+              DMA_PERIPH_TO_MEM | DMA_MINC | DMA_CIRCULAR | DMA_IRQ_HT | DMA_PRIO_HIGH, dmaCallback);
+    USARTx->CR3 |= USART_CR3_DMAR;
+    USARTx->CR1 |= USART_CR1_IDLEIE;
+}
+
+void UART_StopRxDMA(USART_TypeDef *USARTx) {
+    UART_Port_t *port = UART_GetPort(USARTx);
+    if (!port->rxBuf) return;
+
+    USARTx->CR1 &= ~USART_CR1_IDLEIE;
+    USARTx->CR3 &= ~USART_CR3_DMAR;
+    DMA_Stop(port->rxDma);
+    port->rxBuf = 0;
+}
+
+// Polling mode: returns the next contiguous run of received bytes and marks
+// it read. The data stays in place until the DMA wraps round to it.
+uint16_t UART_ReadSpan(USART_TypeDef *USARTx, const uint8_t **data) {
+    UART_Port_t *port = UART_GetPort(USARTx);
+    if (!port->rxBuf) return 0;
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();                                    // rxWritten is also updated by IRQs
+    UART_RxSync(port);
+    uint32_t avail = UART_RxAvailable(port);
+    __set_PRIMASK(primask);
+
+    uint16_t start = port->rxRead % port->rxSize;
+    uint16_t n = (avail < (uint32_t)(port->rxSize - start)) ? avail : port->rxSize - start;
+    *data = &port->rxBuf[start];
+    port->rxRead += n;
+    return n;
+}
+
+uint32_t UART_GetRxOverruns(USART_TypeDef *USARTx) {
+    return UART_GetPort(USARTx)->rxOverruns;
+}
+
+// ---------------- Interrupts ----------------
+static void UART_IRQHandler(UART_Port_t *port) {
+    USART_TypeDef *USARTx = port->USARTx;
+
+    // Line idle after a burst: SR then DR read clears IDLE (no byte is
+    // pending this soon after idle, so the DR read does not steal data)
+    if ((USARTx->CR1 & USART_CR1_IDLEIE) && (USARTx->SR & USART_SR_IDLE)) {
+        (void)USARTx->DR;
+        UART_RxEvent(port);
+    }
+
+    if ((USARTx->CR1 & USART_CR1_TXEIE) && (USARTx->SR & USART_SR_TXE))
+        UART_TxService(port);
+}
+
+void USART1_IRQHandler(void) { UART_IRQHandler(&uart_port[0]); }
+void USART2_IRQHandler(void) { UART_IRQHandler(&uart_port[1]); }
+void USART3_IRQHandler(void) { UART_IRQHandler(&uart_port[2]); }
+
+// Blocking; with DMA receive running (polling mode) reads from the buffer
 char UART_ReadChar(USART_TypeDef *USARTx) {
+    UART_Port_t *port = UART_GetPort(USARTx);
+
+    if (port->rxBuf) {
+        uint32_t avail = 0;
+        while (!avail) {
+            uint32_t primask = __get_PRIMASK();
+            __disable_irq();
+            UART_RxSync(port);
+            avail = UART_RxAvailable(port);
+            __set_PRIMASK(primask);
+        }
+        char c = (char)port->rxBuf[port->rxRead % port->rxSize];
+        port->rxRead++;
+        return c;
+    }
+
     while (!(USARTx->SR & (1 << 5)));
     return (char)(USARTx->DR & 0xFF);
 }
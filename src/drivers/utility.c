@@ -48,194 +48,341 @@ void LED_Off(void)
 #include <stdarg.h>
 #include <stdint.h>
 
-static void u32_to_str(uint32_t value, char *buf) {
-    // Handle zero explicitly
-    if (value == 0) {
-        buf[0] = '0';
-        buf[1] = '\0';
-        return;
-    }
+// ---------------- Formatter core ----------------
+// mini_vformat walks the format once and hands text to a sink in runs: each
+// stretch of literal text in one call, each field as padding plus digits.
+// It keeps no static state and never allocates, so it is safe from
+// interrupts and from several contexts at once.
+//
+//   %[flags][width][.precision][length]conversion
+//   flags       '-' left-align, '0' zero-pad, '+' always sign, ' ' space for +
+//   width/prec  digits or '*'
+//   length      'l' (long is 32 bits here); 'h' is accepted and ignored
+//   conversion  d i u x X c s f %, anything else prints '?'
+//   %f          fixed point, 6 decimals by default and at most 9;
+//               |value| must be below 2^32 ("inf" otherwise)
 
-    char temp[10];   // max 10 digits for uint32_t
-    int i = 0;
+#define MINI_FLAG_LEFT   0x01
+#define MINI_FLAG_ZERO   0x02
+#define MINI_FLAG_PLUS   0x04
+#define MINI_FLAG_SPACE  0x08
 
-    // Extract digits in reverse order
-    while (value > 0) {
-        temp[i++] = '0' + (value % 10);
-        value /= 10;
-    }
+typedef struct {
+    mini_sink_t sink;
+    void *ctx;
+    uint32_t count;                 // characters produced so far
+} mini_fmt_t;
 
-    // Reverse digits directly into output buffer
-    for (int j = 0; j < i; j++) {
-        buf[j] = temp[i - j - 1];
+static const uint32_t mini_pow10[10] = {
+    1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U
+};
+
+// v / 10 without a divide: multiply by 2^35 / 10 (exact for every uint32_t)
+static inline uint32_t mini_div10(uint32_t v) {
+    return (uint32_t)(((uint64_t)v * 0xCCCCCCCDULL) >> 35);
+}
+
+// Writes the digits of v backwards, ending just before 'end'. At least
+// 'min' digits (leading zeros). Returns the first digit.
+static char *mini_utoa(uint32_t v, char *end, uint8_t base16, uint8_t upper, uint8_t min) {
+    const char *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    while (v || min) {
+        if (base16) {
+            *--end = digits[v & 0xF];
+            v >>= 4;
+        } else {
+            uint32_t q = mini_div10(v);
+            *--end = (char)('0' + (v - q * 10U));
+            v = q;
+        }
+        if (min) min--;
     }
-    buf[i] = '\0';  // Null-terminate
+    return end;
 }
 
+static void mini_emit(mini_fmt_t *f, const char *data, uint32_t len) {
+    if (len == 0) return;
+    f->sink(f->ctx, data, len);
+    f->count += len;
+}
 
-static void u32_to_hex(uint32_t value, char *buf) {
-    for (int i = 0; i < 8; i++) {
-        uint8_t nibble = (value >> (28 - i * 4)) & 0xF;
-        buf[i] = (nibble < 10) ? ('0' + nibble) : ('A' + nibble - 10);
+static void mini_pad(mini_fmt_t *f, char c, int32_t n) {
+    char pad[8];
+    for (uint8_t i = 0; i < sizeof(pad); i++) pad[i] = c;
+    while (n > 0) {
+        uint32_t k = (n > (int32_t)sizeof(pad)) ? sizeof(pad) : (uint32_t)n;
+        mini_emit(f, pad, k);
+        n -= (int32_t)k;
     }
-    buf[8] = '\0';
 }
 
-void mini_printf(const char *fmt, ...) {
-    static uint8_t uart_initialized = 0;
-    if (!uart_initialized) {
-        UART_Config_t uart2_cfg = {
-            .baudRate   = 115200,
-            .wordLength = UART_WORDLENGTH_8B,
-            .stopBits   = UART_STOPBITS_1,
-            .parity     = UART_PARITY_NONE,
-            .enableTx   = 1,
-            .enableRx   = 1
-        };
-        UART_Init(USART2, &uart2_cfg);
-        uart_initialized = 1;
+// [spaces][sign][zeros][body][spaces] to fill 'width'
+static void mini_field(mini_fmt_t *f, uint8_t flags, int32_t width, char sign, const char *body, uint32_t len) {
+    int32_t pad = width - (int32_t)len - (sign ? 1 : 0);
+
+    if (!(flags & (MINI_FLAG_LEFT | MINI_FLAG_ZERO))) mini_pad(f, ' ', pad);
+    if (sign) mini_emit(f, &sign, 1);
+    if ((flags & (MINI_FLAG_LEFT | MINI_FLAG_ZERO)) == MINI_FLAG_ZERO) mini_pad(f, '0', pad);
+    mini_emit(f, body, len);
+    if (flags & MINI_FLAG_LEFT) mini_pad(f, ' ', pad);
+}
+
+static char mini_sign(uint8_t negative, uint8_t flags) {
+    if (negative)                return '-';
+    if (flags & MINI_FLAG_PLUS)  return '+';
+    if (flags & MINI_FLAG_SPACE) return ' ';
+    return 0;
+}
+
+// Fixed point: integer part, then 'prec' decimals rounded half up
+static uint32_t mini_ftoa(double v, int32_t prec, char *end, const char **start) {
+    char *p = end;
+    if (v >= 4294967295.0) {
+        *start = "inf";
+        return 3;
     }
 
-    va_list args;
-    va_start(args, fmt);
-    char buf[16];
+    uint32_t ip = (uint32_t)v;
+    uint32_t scale = mini_pow10[prec];
+    uint32_t fp = (uint32_t)((v - (double)ip) * (double)scale + 0.5);
+    if (fp >= scale) {              // 9.9996 → 10.000
+        fp -= scale;
+        ip++;
+    }
+
+    if (prec > 0) {
+        p = mini_utoa(fp, p, 0, 0, (uint8_t)prec);
+        *--p = '.';
+    }
+    p = mini_utoa(ip, p, 0, 0, 1);
+    *start = p;
+    return (uint32_t)(end - p);
+}
+
+int mini_vformat(mini_sink_t sink, void *ctx, const char *fmt, va_list args) {
+    mini_fmt_t f = { sink, ctx, 0 };
+    char num[MINI_PRINTF_BUF_SIZE];
+    char *end = num + sizeof(num);
 
     while (*fmt) {
-        if (*fmt == '%') {
+        // Literal run up to the next conversion
+        const char *run = fmt;
+        while (*fmt && *fmt != '%') fmt++;
+        mini_emit(&f, run, (uint32_t)(fmt - run));
+        if (!*fmt) break;
+        fmt++;
+
+        uint8_t flags = 0;
+        for (;; fmt++) {
+            if      (*fmt == '-') flags |= MINI_FLAG_LEFT;
+            else if (*fmt == '0') flags |= MINI_FLAG_ZERO;
+            else if (*fmt == '+') flags |= MINI_FLAG_PLUS;
+            else if (*fmt == ' ') flags |= MINI_FLAG_SPACE;
+            else break;
+        }
+
+        int32_t width = 0;
+        if (*fmt == '*') {
+            width = va_arg(args, int);
+            if (width < 0) {
+                flags |= MINI_FLAG_LEFT;
+                width = -width;
+            }
             fmt++;
-            switch (*fmt) {
-                case 'd': {
-                    int val = va_arg(args, int);
-                    if (val < 0) {
-                        UART_WriteChar(USART2, '-');
-                        val = -val;
-                    }
-                    u32_to_str((uint32_t)val, buf);
-                    UART_WriteString(USART2, buf);
-                    break;
-                }
-                case 'u': {
-                    uint32_t val = va_arg(args, uint32_t);
-                    u32_to_str(val, buf);
-                    UART_WriteString(USART2, buf);
-                    break;
-                }
-                case 'x':
-                case 'X': {
-                    uint32_t val = va_arg(args, uint32_t);
-                    u32_to_hex(val, buf);
-                    UART_WriteString(USART2, buf);
-                    break;
+        } else {
+            while (*fmt >= '0' && *fmt <= '9') width = width * 10 + (*fmt++ - '0');
+        }
+
+        int32_t prec = -1;
+        if (*fmt == '.') {
+            fmt++;
+            prec = 0;
+            if (*fmt == '*') {
+                prec = va_arg(args, int);
+                if (prec < 0) prec = -1;
+                fmt++;
+            } else {
+                while (*fmt >= '0' && *fmt <= '9') prec = prec * 10 + (*fmt++ - '0');
+            }
+        }
+
+        uint8_t is_long = 0;
+        while (*fmt == 'l' || *fmt == 'h') {
+            if (*fmt == 'l') is_long = 1;
+            fmt++;
+        }
+
+        char conv = *fmt;
+        if (!conv) break;           // lone '%' at the end
+        fmt++;
+
+        switch (conv) {
+            case 'd':
+            case 'i':
+            case 'u':
+            case 'x':
+            case 'X': {
+                uint32_t v;
+                uint8_t negative = 0;
+                if (conv == 'd' || conv == 'i') {
+                    int32_t sv = is_long ? (int32_t)va_arg(args, long) : (int32_t)va_arg(args, int);
+                    negative = sv < 0;
+                    v = negative ? 0U - (uint32_t)sv : (uint32_t)sv;
+                } else {
+                    v = is_long ? (uint32_t)va_arg(args, unsigned long) : (uint32_t)va_arg(args, unsigned int);
                 }
-                case 's': {
-                    char *str = va_arg(args, char *);
-                    UART_WriteString(USART2, str);
-                    break;
+
+                // Precision is the minimum digit count; it disables '0' padding
+                char *p = end;
+                if (prec < 0) p = mini_utoa(v, end, conv == 'x' || conv == 'X', conv == 'X', 1);
+                else {
+                    if (prec > (int32_t)sizeof(num)) prec = sizeof(num);
+                    p = mini_utoa(v, end, conv == 'x' || conv == 'X', conv == 'X', (uint8_t)prec);
+                    flags &= ~MINI_FLAG_ZERO;
                 }
-                case 'c': {
-                    char c = (char)va_arg(args, int);
-                    UART_WriteChar(USART2, c);
-                    break;
+                char sign = (conv == 'd' || conv == 'i') ? mini_sign(negative, flags) : 0;
+                mini_field(&f, flags, width, sign, p, (uint32_t)(end - p));
+                break;
+            }
+            case 'f': {
+                double v = va_arg(args, double);        // float is promoted
+                uint8_t negative = v < 0;
+                if (negative) v = -v;
+                if (prec < 0) prec = 6;
+                if (prec > 9) prec = 9;
+
+                const char *p;
+                uint32_t len;
+                if (v != v) {
+                    p = "nan";
+                    len = 3;
+                } else {
+                    len = mini_ftoa(v, prec, end, &p);
                 }
-                case '%':
-                    UART_WriteChar(USART2, '%');
-                    break;
-                default:
-                    UART_WriteChar(USART2, '?');
-                    break;
+                mini_field(&f, flags, width, mini_sign(negative, flags), p, len);
+                break;
             }
-        } else {
-            UART_WriteChar(USART2, *fmt);
+            case 's': {
+                const char *str = va_arg(args, const char *);
+                if (!str) str = "(null)";
+                uint32_t len = 0;
+                while (str[len] && (prec < 0 || len < (uint32_t)prec)) len++;
+                mini_field(&f, flags & ~MINI_FLAG_ZERO, width, 0, str, len);
+                break;
+            }
+            case 'c': {
+                char c = (char)va_arg(args, int);
+                mini_field(&f, flags & ~MINI_FLAG_ZERO, width, 0, &c, 1);
+                break;
+            }
+            case '%':
+                mini_emit(&f, "%", 1);
+                break;
+            default:
+                mini_emit(&f, "?", 1);
+                break;
         }
-        fmt++;
     }
 
-    va_end(args);
+    return (int)f.count;
 }
 
-// Convert signed integer to string
-static void i32_to_str(int32_t val, char *buf) {
-    if(val < 0) {
-        *buf++ = '-';
-        u32_to_str(-val, buf);
-    } else {
-        u32_to_str(val, buf);
-    }
+int mini_format(mini_sink_t sink, void *ctx, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int n = mini_vformat(sink, ctx, fmt, args);
+    va_end(args);
+    return n;
 }
 
+// ---------------- Buffer output ----------------
+typedef struct {
+    char *buf;
+    uint32_t size;
+    uint32_t n;
+} mini_buf_t;
 
-// Convert float to string with 1 decimal (fixed-point)
-static void float_to_str(float val, char *buf) {
-    int32_t int_part = (int32_t)val;
-    int32_t frac = (int32_t)((val - int_part) * 10); // 1 decimal
-    if(frac < 0) frac = -frac;
-    i32_to_str(int_part, buf);
-    while(*buf) buf++;          // move to end
-    *buf++ = '.';
-    *buf++ = '0' + frac;
-    *buf = 0;
+// Keeps what fits and leaves room for the terminating NUL
+static void mini_buf_sink(void *ctx, const char *data, uint32_t len) {
+    mini_buf_t *b = (mini_buf_t *)ctx;
+    uint32_t room = b->size - 1 - b->n;
+    if (len > room) len = room;
+    for (uint32_t i = 0; i < len; i++) b->buf[b->n + i] = data[i];
+    b->n += len;
 }
 
+// Format into buf (always NUL-terminated, truncated to fit).
+// Returns the number of characters written.
+int mini_vsnprintf(char *buf, uint32_t size, const char *fmt, va_list args) {
+    if (size == 0) return 0;
+    mini_buf_t b = { buf, size, 0 };
+    mini_vformat(mini_buf_sink, &b, fmt, args);
+    buf[b.n] = '\0';
+    return (int)b.n;
+}
 
-void ST7789_mini_printf(uint16_t x, uint16_t y, uint16_t color, uint16_t bg, uint8_t scale, const char *fmt, ...) {
-    char buf[16];
+int mini_snprintf(char *buf, uint32_t size, const char *fmt, ...) {
     va_list args;
     va_start(args, fmt);
+    int n = mini_vsnprintf(buf, size, fmt, args);
+    va_end(args);
+    return n;
+}
 
-    while(*fmt) {
-        if(*fmt == '%') {
-            fmt++;
-            switch(*fmt) {
-                case 'd': {
-                    int val = va_arg(args, int);
-                    i32_to_str(val, buf);
-                    ST7789_DrawStringScaled(x, y, buf, color, bg, scale);
-                    x += strlen(buf)*6*scale;
-                    break;
-                }
-                case 'u': {
-                    unsigned int val = va_arg(args, unsigned int);
-                    u32_to_str(val, buf);
-                    ST7789_DrawStringScaled(x, y, buf, color, bg, scale);
-                    x += strlen(buf)*6*scale;
-                    break;
-                }
-                case 'f': {
-                    double val = va_arg(args, double); // float promoted to double
-                    float_to_str((float)val, buf);
-                    ST7789_DrawStringScaled(x, y, buf, color, bg, scale);
-                    x += strlen(buf)*6*scale;
-                    break;
-                }
-                case 's': {
-                    char *str = va_arg(args, char*);
-                    ST7789_DrawStringScaled(x, y, str, color, bg, scale);
-                    x += strlen(str)*6*scale;
-                    break;
-                }
-                case 'c': {
-                    char c = (char)va_arg(args, int);
-                    char ch[2] = {c, 0};
-                    ST7789_DrawStringScaled(x, y, ch, color, bg, scale);
-                    x += 6*scale;
-                    break;
-                }
-                case '%': {
-                    char ch[2] = {'%',0};
-                    ST7789_DrawStringScaled(x, y, ch, color, bg, scale);
-                    x += 6*scale;
-                    break;
-                }
-                default: break;
-            }
-        } else {
-            char ch[2] = {*fmt,0};
-            ST7789_DrawStringScaled(x, y, ch, color, bg, scale);
-            x += 6*scale;
-        }
-        fmt++;
+// ---------------- UART output ----------------
+// mini_printf formats into a line buffer on the stack and hands it to the
+// UART in one block (more only for lines longer than the buffer)
+typedef struct {
+    char buf[MINI_PRINTF_LINE_SIZE];
+    uint32_t n;
+} mini_line_t;
+
+static void mini_line_flush(mini_line_t *line) {
+    UART_Write(USART2, (const uint8_t *)line->buf, line->n);
+    line->n = 0;
+}
+
+static void mini_line_sink(void *ctx, const char *data, uint32_t len) {
+    mini_line_t *line = (mini_line_t *)ctx;
+    while (len--) {
+        if (line->n == sizeof(line->buf)) mini_line_flush(line);
+        line->buf[line->n++] = *data++;
+    }
+}
+
+void mini_printf(const char *fmt, ...) {
+    static uint8_t uart_initialized = 0;
+    if (!uart_initialized) {
+        UART_Config_t uart2_cfg = {
+            .baudRate   = 115200,
+            .wordLength = UART_WORDLENGTH_8B,
+            .stopBits   = UART_STOPBITS_1,
+            .parity     = UART_PARITY_NONE,
+            .enableTx   = 1,
+            .enableRx   = 1,
+            .txDma      = 1                 // DMA1 CH7 drains the ring
+        };
+        UART_Init(USART2, &uart2_cfg);
+        uart_initialized = 1;
     }
 
+    mini_line_t line;
+    line.n = 0;
+
+    va_list args;
+    va_start(args, fmt);
+    mini_vformat(mini_line_sink, &line, fmt, args);
     va_end(args);
+    mini_line_flush(&line);
 }
 
+// Format the whole line first, then draw it with a single text run
+void ST7789_mini_printf(uint16_t x, uint16_t y, uint16_t color, uint16_t bg, uint8_t scale, const char *fmt, ...) {
+    char buf[MINI_PRINTF_LINE_SIZE];
+    va_list args;
+    va_start(args, fmt);
+    mini_vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+
+    ST7789_DrawStringScaled(x, y, buf, color, bg, scale);
+}
@@ -0,0 +1,129 @@
+// Generated by tools/fontconv.py from SourceCodePro-Bold.ttf
+// 50 px line, 2 bpp, codes 32..58, 1374 bytes of bitmap
+// Source Code Pro: Copyright 2010, 2012 Adobe Systems Incorporated, with
+// Reserved Font Name 'Source'. Licensed under the SIL Open Font License, Version 1.1.
+#include "display_font.h"
+
+static const uint8_t font_digits40_bitmap[1374] = {
+    0x7F,0xFF,0xFF,0xFF,0xFD,0x7F,0xFF,0xFF,0xFF,0xFD,0x7F,0xFF,0xFF,0xFF,0xFD,0x7F,
+    0xFF,0xFF,0xFF,0xFD,0x7F,0xFF,0xFF,0xFF,0xFD,0x06,0xF9,0x01,0xFF,0xF4,0x3F,0xFF,
+    0xCB,0xFF,0xFE,0xBF,0xFF,0xEB,0xFF,0xFE,0x7F,0xFF,0xD2,0xFF,0xF8,0x06,0xF9,0x00,
+    0x00,0x06,0xFF,0x90,0x00,0x00,0x7F,0xFF,0xFD,0x00,0x01,0xFF,0xFF,0xFF,0x40,0x07,
+    0xFF,0xFF,0xFF,0xD0,0x0F,0xFF,0xFF,0xFF,0xF0,0x1F,0xFE,0x41,0xBF,0xF4,0x3F,0xFC,
+    0x00,0x3F,0xFC,0x3F,0xF4,0x00,0x1F,0xFC,0x7F,0xF0,0x00,0x0F,0xFD,0xBF,0xE0,0xBE,
+    0x0B,0xFE,0xBF,0xE2,0xFF,0x8B,0xFE,0xBF,0xE3,0xFF,0xCB,0xFE,0xBF,0xD3,0xFF,0xC7,
+    0xFE,0xBF,0xE2,0xFF,0x8B,0xFE,0xBF,0xE0,0xBE,0x0B,0xFE,0xBF,0xE0,0x00,0x0B,0xFE,
+    0x7F,0xF0,0x00,0x0F,0xFD,0x3F,0xF4,0x00,0x1F,0xFC,0x2F,0xFC,0x00,0x3F,0xF8,0x1F,
+    0xFF,0x41,0xFF,0xF4,0x0F,0xFF,0xFF,0xFF,0xF0,0x07,0xFF,0xFF,0xFF,0xD0,0x01,0xFF,
+    0xFF,0xFF,0x40,0x00,0x7F,0xFF,0xFD,0x00,0x00,0x06,0xFF,0x90,0x00,0x00,0x06,0xFF,
+    0x80,0x00,0x16,0xFF,0xFE,0x00,0x01,0xFF,0xFF,0xF8,0x00,0x07,0xFF,0xFF,0xE0,0x00,
+    0x1F,0xFF,0xFF,0x80,0x00,0x7F,0xFF,0xFE,0x00,0x00,0x00,0x3F,0xF8,0x00,0x00,0x00,
+    0xFF,0xE0,0x00,0x00,0x03,0xFF,0x80,0x00,0x00,0x0F,0xFE,0x00,0x00,0x00,0x3F,0xF8,
+    0x00,0x00,0x00,0xFF,0xE0,0x00,0x00,0x03,0xFF,0x80,0x00,0x00,0x0F,0xFE,0x00,0x00,
+    0x00,0x3F,0xF8,0x00,0x00,0x00,0xFF,0xE0,0x00,0x00,0x03,0xFF,0x80,0x00,0x00,0x0F,
+    0xFE,0x00,0x00,0x00,0x3F,0xF8,0x00,0x00,0x00,0xFF,0xE0,0x00,0xBF,0xFF,0xFF,0xFF,
+    0xF6,0xFF,0xFF,0xFF,0xFF,0xDB,0xFF,0xFF,0xFF,0xFF,0x6F,0xFF,0xFF,0xFF,0xFD,0xBF,
+    0xFF,0xFF,0xFF,0xF4,0x00,0x1B,0xFE,0x40,0x00,0x02,0xFF,0xFF,0xF8,0x00,0x0F,0xFF,
+    0xFF,0xFF,0x00,0x7F,0xFF,0xFF,0xFF,0x80,0xBF,0xFF,0xFF,0xFF,0xD0,0x2F,0xE4,0x07,
+    0xFF,0xE0,0x0B,0x80,0x00,0xFF,0xF0,0x01,0x00,0x00,0xBF,0xF0,0x00,0x00,0x00,0xBF,
+    0xF0,0x00,0x00,0x00,0xBF,0xE0,0x00,0x00,0x01,0xFF,0xD0,0x00,0x00,0x02,0xFF,0xC0,
+    0x00,0x00,0x0B,0xFF,0x40,0x00,0x00,0x1F,0xFE,0x00,0x00,0x00,0x7F,0xF8,0x00,0x00,
+    0x01,0xFF,0xF0,0x00,0x00,0x0B,0xFF,0xC0,0x00,0x00,0x2F,0xFE,0x00,0x00,0x00,0xBF,
+    0xF8,0x00,0x00,0x07,0xFF,0xE0,0x00,0x00,0x1F,0xFF,0xEF,0xFF,0xFD,0x7F,0xFF,0xFF,
+    0xFF,0xFD,0xBF,0xFF,0xFF,0xFF,0xFD,0xBF,0xFF,0xFF,0xFF,0xFD,0xBF,0xFF,0xFF,0xFF,
+    0xFD,0x00,0x06,0xFF,0xA4,0x00,0x00,0x2F,0xFF,0xFF,0xE0,0x00,0x7F,0xFF,0xFF,0xFE,
+    0x00,0x7F,0xFF,0xFF,0xFF,0xE0,0x0B,0xFF,0xFF,0xFF,0xFC,0x00,0xFF,0x40,0x6F,0xFF,
+    0x40,0x1D,0x00,0x02,0xFF,0xD0,0x00,0x00,0x00,0xBF,0xF4,0x00,0x00,0x05,0xFF,0xF8,
+    0x00,0x01,0xFF,0xFF,0xF8,0x00,0x00,0x7F,0xFF,0xE4,0x00,0x00,0x1F,0xFF,0xF4,0x00,
+    0x00,0x07,0xFF,0xFF,0xD0,0x00,0x01,0xFF,0xFF,0xFD,0x00,0x00,0x00,0x5B,0xFF,0xD0,
+    0x00,0x00,0x00,0x7F,0xFC,0x00,0x00,0x00,0x0B,0xFF,0x00,0x40,0x00,0x02,0xFF,0xD0,
+    0x78,0x00,0x00,0xFF,0xF0,0x3F,0xE4,0x06,0xFF,0xFC,0x2F,0xFF,0xFF,0xFF,0xFD,0x0F,
+    0xFF,0xFF,0xFF,0xFE,0x00,0xBF,0xFF,0xFF,0xFE,0x00,0x07,0xFF,0xFF,0xFD,0x00,0x00,
+    0x1A,0xFF,0xA4,0x00,0x00,0x00,0x00,0x07,0xFF,0xF0,0x00,0x00,0x00,0xFF,0xFF,0x00,
+    0x00,0x00,0x2F,0xFF,0xF0,0x00,0x00,0x0B,0xFF,0xFF,0x00,0x00,0x01,0xFF,0xFF,0xF0,
+    0x00,0x00,0x3F,0xFB,0xFF,0x00,0x00,0x0B,0xFE,0x7F,0xF0,0x00,0x02,0xFF,0xC7,0xFF,
+    0x00,0x00,0x7F,0xF4,0x7F,0xF0,0x00,0x0F,0xFE,0x07,0xFF,0x00,0x02,0xFF,0x80,0x7F,
+    0xF0,0x00,0x7F,0xF0,0x07,0xFF,0x00,0x1F,0xFD,0x00,0x7F,0xF0,0x03,0xFF,0x40,0x07,
+    0xFF,0x00,0xBF,0xFF,0xFF,0xFF,0xFF,0xDB,0xFF,0xFF,0xFF,0xFF,0xFD,0xBF,0xFF,0xFF,
+    0xFF,0xFF,0xDB,0xFF,0xFF,0xFF,0xFF,0xFD,0xBF,0xFF,0xFF,0xFF,0xFF,0xD0,0x00,0x00,
+    0x07,0xFF,0x00,0x00,0x00,0x00,0x7F,0xF0,0x00,0x00,0x00,0x07,0xFF,0x00,0x00,0x00,
+    0x00,0x7F,0xF0,0x00,0x00,0x00,0x07,0xFF,0x00,0x00,0x00,0x00,0x7F,0xF0,0x00,0x01,
+    0xFF,0xFF,0xFF,0xFC,0x00,0xBF,0xFF,0xFF,0xFF,0x00,0x2F,0xFF,0xFF,0xFF,0xC0,0x0B,
+    0xFF,0xFF,0xFF,0xF0,0x02,0xFF,0xFF,0xFF,0xFC,0x00,0xBF,0xE0,0x00,0x00,0x00,0x2F,
+    0xF4,0x00,0x00,0x00,0x0F,0xFD,0x00,0x00,0x00,0x03,0xFF,0x5F,0xE9,0x00,0x00,0xFF,
+    0xFF,0xFF,0xE4,0x00,0x3F,0xFF,0xFF,0xFF,0x40,0x0F,0xFF,0xFF,0xFF,0xF0,0x03,0xFF,
+    0xFF,0xFF,0xFE,0x00,0x2E,0x40,0x6F,0xFF,0xC0,0x00,0x00,0x01,0xFF,0xF0,0x00,0x00,
+    0x00,0x2F,0xFD,0x00,0x00,0x00,0x0B,0xFF,0x40,0x40,0x00,0x02,0xFF,0xC0,0x79,0x00,
+    0x01,0xFF,0xF0,0x3F,0xE4,0x06,0xFF,0xF8,0x2F,0xFF,0xFF,0xFF,0xFC,0x0B,0xFF,0xFF,
+    0xFF,0xFD,0x00,0xBF,0xFF,0xFF,0xFD,0x00,0x06,0xFF,0xFF,0xF9,0x00,0x00,0x1A,0xFF,
+    0xA4,0x00,0x00,0x00,0x01,0xAF,0xE9,0x00,0x00,0x1B,0xFF,0xFF,0x90,0x00,0x7F,0xFF,
+    0xFF,0xF8,0x01,0xFF,0xFF,0xFF,0xFD,0x07,0xFF,0xFF,0xFF,0xF4,0x0F,0xFF,0xD0,0x1B,
+    0xD0,0x1F,0xFE,0x00,0x01,0x80,0x2F,0xFC,0x00,0x00,0x00,0x3F,0xF8,0x00,0x00,0x00,
+    0x7F,0xF4,0x1B,0xF9,0x00,0x7F,0xF1,0xFF,0xFF,0x90,0x7F,0xF7,0xFF,0xFF,0xF0,0xBF,
+    0xFF,0xFF,0xFF,0xF8,0xBF,0xFF,0xFF,0xFF,0xFD,0x7F,0xFF,0x40,0x6F,0xFE,0x7F,0xF8,
+    0x00,0x0F,0xFE,0x7F,0xF0,0x00,0x0B,0xFE,0x3F,0xF4,0x00,0x0B,0xFE,0x2F,0xFC,0x00,
+    0x0F,0xFE,0x1F,0xFF,0x40,0x7F,0xFD,0x0B,0xFF,0xFF,0xFF,0xF8,0x03,0xFF,0xFF,0xFF,
+    0xF4,0x00,0xFF,0xFF,0xFF,0xD0,0x00,0x2F,0xFF,0xFE,0x40,0x00,0x01,0xBF,0xE4,0x00,
+    0xBF,0xFF,0xFF,0xFF,0xFE,0xBF,0xFF,0xFF,0xFF,0xFE,0xBF,0xFF,0xFF,0xFF,0xFE,0xBF,
+    0xFF,0xFF,0xFF,0xFE,0xBF,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x7F,0xF0,0x00,0x00,
+    0x00,0xFF,0xD0,0x00,0x00,0x02,0xFF,0x40,0x00,0x00,0x07,0xFE,0x00,0x00,0x00,0x0F,
+    0xFC,0x00,0x00,0x00,0x2F,0xF8,0x00,0x00,0x00,0x3F,0xF0,0x00,0x00,0x00,0xBF,0xE0,
+    0x00,0x00,0x00,0xFF,0xD0,0x00,0x00,0x01,0xFF,0xC0,0x00,0x00,0x02,0xFF,0x80,0x00,
+    0x00,0x03,0xFF,0x80,0x00,0x00,0x07,0xFF,0x40,0x00,0x00,0x07,0xFF,0x40,0x00,0x00,
+    0x0B,0xFF,0x00,0x00,0x00,0x0F,0xFF,0x00,0x00,0x00,0x0F,0xFF,0x00,0x00,0x00,0x0F,
+    0xFE,0x00,0x00,0x00,0x1F,0xFE,0x00,0x00,0x00,0x1F,0xFE,0x00,0x00,0x00,0x06,0xFF,
+    0xA0,0x00,0x00,0xBF,0xFF,0xFE,0x00,0x02,0xFF,0xFF,0xFF,0x80,0x0B,0xFF,0xFF,0xFF,
+    0xE0,0x0F,0xFF,0xFF,0xFF,0xF0,0x1F,0xFE,0x41,0xBF,0xF4,0x1F,0xFC,0x00,0x2F,0xF4,
+    0x1F,0xF8,0x00,0x1F,0xF4,0x0F,0xFC,0x00,0x1F,0xF0,0x07,0xFE,0x40,0x3F,0xE0,0x01,
+    0xFF,0xE4,0xBF,0x80,0x00,0x7F,0xFF,0xFE,0x00,0x00,0xBF,0xFF,0xFD,0x00,0x07,0xFF,
+    0xFF,0xFF,0xD0,0x1F,0xFD,0x1B,0xFF,0xF4,0x3F,0xF4,0x00,0xBF,0xFC,0x7F,0xE0,0x00,
+    0x1F,0xFD,0xBF,0xE0,0x00,0x0F,0xFE,0xBF,0xF0,0x00,0x0F,0xFE,0x7F,0xFD,0x40,0x7F,
+    0xFD,0x3F,0xFF,0xFF,0xFF,0xFC,0x2F,0xFF,0xFF,0xFF,0xF8,0x0B,0xFF,0xFF,0xFF,0xE0,
+    0x01,0xFF,0xFF,0xFF,0x40,0x00,0x1A,0xFF,0xA4,0x00,0x00,0x1B,0xFE,0x40,0x00,0x01,
+    0xFF,0xFF,0xF8,0x00,0x07,0xFF,0xFF,0xFF,0x00,0x1F,0xFF,0xFF,0xFF,0xC0,0x3F,0xFF,
+    0xFF,0xFF,0xE0,0x7F,0xFD,0x01,0xFF,0xF0,0xBF,0xF0,0x00,0x7F,0xF8,0xBF,0xE0,0x00,
+    0x2F,0xFC,0xFF,0xE0,0x00,0x0F,0xFD,0xBF,0xE0,0x00,0x2F,0xFD,0xBF,0xF9,0x01,0xFF,
+    0xFD,0x7F,0xFF,0xFF,0xFF,0xFD,0x3F,0xFF,0xFF,0xFF,0xFD,0x1F,0xFF,0xFF,0xDF,0xFD,
+    0x07,0xFF,0xFF,0x4F,0xFD,0x00,0x6F,0xE4,0x1F,0xFD,0x00,0x00,0x00,0x2F,0xFC,0x00,
+    0x00,0x00,0x3F,0xF8,0x02,0x00,0x00,0xFF,0xF4,0x0B,0xE4,0x17,0xFF,0xE0,0x1F,0xFF,
+    0xFF,0xFF,0xD0,0x7F,0xFF,0xFF,0xFF,0x40,0x2F,0xFF,0xFF,0xFD,0x00,0x07,0xFF,0xFF,
+    0xE4,0x00,0x00,0x6B,0xFA,0x40,0x00,0x06,0xF9,0x01,0xFF,0xF4,0x3F,0xFF,0xCB,0xFF,
+    0xFE,0xBF,0xFF,0xEB,0xFF,0xFE,0x7F,0xFF,0xD2,0xFF,0xF8,0x06,0xF9,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0x90,0x1F,0xFF,0x43,0xFF,0xFC,0xBF,
+    0xFF,0xEB,0xFF,0xFE,0xBF,0xFF,0xE7,0xFF,0xFD,0x2F,0xFF,0x80,0x6F,0x90,
+};
+
+static const FONT_Glyph_t font_digits40_glyphs[27] = {
+    {    0,   0,   0,    0,    0,  24}, // ' '
+    {    0,   0,   0,    0,    0,   0}, // missing
+    {    0,   0,   0,    0,    0,   0}, // missing
+    {    0,   0,   0,    0,    0,   0}, // missing
+    {    0,   0,   0,    0,    0,   0}, // missing
+    {    0,   0,   0,    0,    0,   0}, // missing
+    {    0,   0,   0,    0,    0,   0}, // missing
+    {    0,   0,   0,    0,    0,   0}, // missing
+    {    0,   0,   0,    0,    0,   0}, // missing
+    {    0,   0,   0,    0,    0,   0}, // missing
+    {    0,   0,   0,    0,    0,   0}, // missing
+    {    0,   0,   0,    0,    0,   0}, // missing
+    {    0,   0,   0,    0,    0,   0}, // missing
+    {    0,  20,   5,    2,  -16,  24}, // '-'
+    {   25,  10,   9,    7,   -9,  24}, // '.'
+    {    0,   0,   0,    0,    0,   0}, // missing
+    {   48,  20,  25,    2,  -25,  24}, // '0'
+    {  173,  19,  25,    3,  -25,  24}, // '1'
+    {  292,  20,  25,    2,  -25,  24}, // '2'
+    {  417,  21,  25,    1,  -25,  24}, // '3'
+    {  549,  22,  25,    1,  -25,  24}, // '4'
+    {  687,  21,  25,    1,  -25,  24}, // '5'
+    {  819,  20,  25,    2,  -25,  24}, // '6'
+    {  944,  20,  25,    2,  -25,  24}, // '7'
+    { 1069,  20,  25,    2,  -25,  24}, // '8'
+    { 1194,  20,  25,    2,  -25,  24}, // '9'
+    { 1319,  10,  22,    7,  -22,  24}, // ':'
+};
+
+const FONT_t font_digits40 = {
+    .bitmap = font_digits40_bitmap, .glyphs = font_digits40_glyphs,
+    .first = 32, .last = 58, .height = 50, .baseline = 40, .bpp = 2
+};
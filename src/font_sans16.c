@@ -0,0 +1,346 @@
+// Generated by tools/fontconv.py from Lato-Regular.ttf
+// 19 px line, 4 bpp, codes 32..126, 3751 bytes of bitmap
+// Lato: Copyright (c) 2010-2013 by tyPoland Lukasz Dziedzic with Reserved
+// Font Name "Lato". Licensed under the SIL Open Font License, Version 1.1.
+#include "display_font.h"
+
+static const uint8_t font_sans16_bitmap[3751] = {
+    0x0E,0x70,0xE7,0x0E,0x70,0xE7,0x0E,0x60,0xD6,0x0C,0x50,0x00,0x00,0x00,0x00,0x2E,
+    0x80,0xC7,0x2F,0x2C,0x72,0xF2,0xB6,0x1F,0x19,0x40,0xD0,0x00,0x08,0x80,0x7A,0x00,
+    0x00,0xD5,0x0A,0x70,0x00,0x1F,0x10,0xE4,0x01,0xEF,0xFF,0xFF,0xFA,0x00,0x7B,0x04,
+    0xD0,0x00,0x09,0x90,0x7B,0x00,0x00,0xC6,0x09,0x80,0x08,0xFF,0xFF,0xFF,0xF4,0x02,
+    0xF1,0x0E,0x30,0x00,0x5C,0x03,0xE0,0x00,0x09,0x80,0x5B,0x00,0x00,0x00,0x00,0x2B,
+    0x00,0x00,0x00,0x03,0xB0,0x00,0x00,0x3C,0xFF,0xB4,0x00,0x3F,0x87,0xA7,0xB1,0x08,
+    0xB0,0x67,0x00,0x00,0x8D,0x17,0x60,0x00,0x03,0xED,0xC6,0x00,0x00,0x02,0x9E,0xFC,
+    0x40,0x00,0x00,0xA6,0xBF,0x30,0x00,0x0B,0x20,0xE7,0x01,0x00,0xD1,0x1F,0x50,0xEB,
+    0x4E,0x4B,0xC0,0x02,0xAE,0xFE,0x91,0x00,0x00,0x1D,0x00,0x00,0x00,0x02,0xB0,0x00,
+    0x00,0x06,0xDE,0x90,0x00,0x07,0xC0,0x3E,0x21,0xC6,0x00,0x4E,0x20,0x6B,0x00,0x89,
+    0x02,0xE4,0x00,0x3E,0x21,0xC6,0x0C,0x70,0x00,0x07,0xEE,0x90,0x9B,0x00,0x00,0x00,
+    0x00,0x06,0xD1,0x00,0x00,0x00,0x00,0x3E,0x33,0xCE,0xB2,0x00,0x01,0xD6,0x0D,0x61,
+    0x8B,0x00,0x0B,0x90,0x0F,0x10,0x2E,0x00,0x8C,0x00,0x0D,0x60,0x7B,0x04,0xE2,0x00,
+    0x03,0xCE,0xB2,0x00,0x08,0xDE,0xB3,0x00,0x00,0x00,0x8D,0x31,0x8E,0x00,0x00,0x00,
+    0xB9,0x00,0x04,0x00,0x00,0x00,0x8C,0x00,0x00,0x00,0x00,0x00,0x2F,0x90,0x00,0x00,
+    0x00,0x04,0xE9,0xD9,0x00,0x5D,0x00,0x1E,0x80,0x2E,0xA0,0x8A,0x00,0x4F,0x20,0x02,
+    0xEB,0xE5,0x00,0x4F,0x40,0x00,0x3F,0xE0,0x00,0x0C,0xC3,0x03,0xBD,0xEA,0x00,0x01,
+    0x9E,0xFC,0x71,0x3D,0xA0,0xC7,0xC7,0xB6,0x94,0x00,0x30,0x04,0xE0,0x0C,0x90,0x2F,
+    0x20,0x7C,0x00,0xA9,0x00,0xD6,0x00,0xD5,0x00,0xD5,0x00,0xD6,0x00,0xA9,0x00,0x7C,
+    0x00,0x2F,0x20,0x0B,0x90,0x03,0xE1,0x00,0x20,0x02,0x00,0x4D,0x10,0x0D,0x70,0x07,
+    0xD0,0x02,0xF3,0x00,0xD6,0x00,0xB8,0x00,0xA9,0x00,0xA9,0x00,0xB8,0x00,0xE6,0x02,
+    0xF2,0x07,0xC0,0x0D,0x60,0x5D,0x00,0x02,0x00,0x00,0x38,0x00,0x1B,0x69,0x95,0x01,
+    0xCF,0x50,0x1B,0x69,0x95,0x00,0x38,0x00,0x00,0x00,0xE3,0x00,0x00,0x00,0x0E,0x30,
+    0x00,0x00,0x00,0xE3,0x00,0x00,0x00,0x0E,0x30,0x00,0x3F,0xFF,0xFF,0xFF,0x70,0x00,
+    0x0E,0x30,0x00,0x00,0x00,0xE3,0x00,0x00,0x00,0x0E,0x30,0x00,0x2E,0x80,0x68,0x1B,
+    0x10,0x00,0x3F,0xFF,0xB0,0x2E,0x70,0x00,0x00,0x04,0xC0,0x00,0x00,0x0B,0x70,0x00,
+    0x00,0x2E,0x10,0x00,0x00,0x89,0x00,0x00,0x00,0xE3,0x00,0x00,0x06,0xC0,0x00,0x00,
+    0x0C,0x50,0x00,0x00,0x3E,0x00,0x00,0x00,0x98,0x00,0x00,0x01,0xE2,0x00,0x00,0x07,
+    0xA0,0x00,0x00,0x0D,0x30,0x00,0x00,0x00,0x6C,0xFD,0x80,0x00,0x6E,0x51,0x3D,0xA0,
+    0x1E,0x70,0x00,0x4F,0x44,0xF2,0x00,0x00,0xD8,0x7F,0x00,0x00,0x0B,0xB8,0xF0,0x00,
+    0x00,0xBC,0x7F,0x00,0x00,0x0B,0xB4,0xF2,0x00,0x00,0xD9,0x1E,0x70,0x00,0x4F,0x40,
+    0x6E,0x51,0x3D,0xA0,0x00,0x6C,0xFD,0x80,0x00,0x00,0x08,0xF3,0x00,0x01,0xBF,0xF3,
+    0x00,0x2D,0xC5,0xF3,0x00,0x17,0x14,0xF3,0x00,0x00,0x04,0xF3,0x00,0x00,0x04,0xF3,
+    0x00,0x00,0x04,0xF3,0x00,0x00,0x04,0xF3,0x00,0x00,0x04,0xF3,0x00,0x00,0x04,0xF3,
+    0x00,0x0B,0xFF,0xFF,0xF7,0x00,0x4C,0xED,0x91,0x00,0x5F,0x61,0x2C,0xB0,0x0C,0x90,
+    0x00,0x4F,0x30,0x11,0x00,0x05,0xF3,0x00,0x00,0x00,0xAD,0x00,0x00,0x00,0x6F,0x50,
+    0x00,0x00,0x5F,0x80,0x00,0x00,0x6F,0x80,0x00,0x00,0x6F,0x80,0x00,0x00,0x7F,0x80,
+    0x00,0x00,0x2F,0xFE,0xFF,0xFF,0x60,0x00,0x3B,0xEE,0xA2,0x00,0x3E,0x81,0x2B,0xD0,
+    0x09,0xB0,0x00,0x3F,0x30,0x11,0x00,0x03,0xF3,0x00,0x00,0x13,0xCA,0x00,0x00,0x0C,
+    0xFC,0x20,0x00,0x00,0x02,0x9E,0x20,0x00,0x00,0x00,0xE8,0x0D,0x50,0x00,0x1E,0x70,
+    0x8E,0x51,0x2A,0xD1,0x00,0x7D,0xFD,0x92,0x00,0x00,0x00,0x08,0xF3,0x00,0x00,0x05,
+    0xEF,0x30,0x00,0x02,0xE6,0xF3,0x00,0x01,0xD9,0x0F,0x30,0x00,0xAC,0x00,0xF3,0x00,
+    0x7E,0x20,0x0F,0x30,0x4F,0x40,0x00,0xF3,0x08,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x00,
+    0xF3,0x00,0x00,0x00,0x0F,0x30,0x00,0x00,0x00,0xF3,0x00,0x00,0xBF,0xFF,0xFB,0x00,
+    0x0D,0x50,0x00,0x00,0x01,0xF2,0x00,0x00,0x00,0x4E,0x00,0x00,0x00,0x06,0xFD,0xFD,
+    0x80,0x00,0x14,0x11,0x5E,0x90,0x00,0x00,0x00,0x7F,0x10,0x00,0x00,0x05,0xF2,0x00,
+    0x00,0x00,0x8E,0x00,0x96,0x11,0x6F,0x50,0x06,0xCE,0xEB,0x40,0x00,0x00,0x00,0x1D,
+    0xB0,0x00,0x00,0x0B,0xC1,0x00,0x00,0x08,0xD2,0x00,0x00,0x05,0xE3,0x00,0x00,0x02,
+    0xED,0xEE,0xB3,0x00,0xAE,0x51,0x2B,0xE1,0x1F,0x70,0x00,0x1F,0x72,0xF4,0x00,0x00,
+    0xD8,0x0E,0x70,0x00,0x1F,0x60,0x7E,0x41,0x3B,0xC0,0x00,0x6D,0xFE,0x81,0x00,0x2F,
+    0xFF,0xFF,0xFF,0xA0,0x00,0x00,0x02,0xF6,0x00,0x00,0x00,0xAD,0x00,0x00,0x00,0x3F,
+    0x50,0x00,0x00,0x0B,0xD0,0x00,0x00,0x03,0xF5,0x00,0x00,0x00,0xBC,0x00,0x00,0x00,
+    0x4F,0x50,0x00,0x00,0x0C,0xC0,0x00,0x00,0x04,0xF4,0x00,0x00,0x00,0xCA,0x00,0x00,
+    0x00,0x00,0x5C,0xED,0x80,0x00,0x5F,0x51,0x3D,0x90,0x0B,0xA0,0x00,0x6F,0x00,0xBA,
+    0x00,0x06,0xF0,0x05,0xE5,0x13,0xD8,0x00,0x08,0xFF,0xFB,0x10,0x0A,0xD4,0x12,0xBD,
+    0x12,0xF5,0x00,0x01,0xF6,0x3F,0x50,0x00,0x1F,0x70,0xBD,0x41,0x2B,0xE1,0x01,0x8D,
+    0xFD,0xA2,0x00,0x03,0xBE,0xEA,0x20,0x3F,0x71,0x18,0xD1,0xBB,0x00,0x00,0xD7,0xBB,
+    0x00,0x00,0xD9,0x6F,0x61,0x19,0xF7,0x07,0xDE,0xCD,0xF2,0x00,0x00,0x4F,0x80,0x00,
+    0x01,0xEC,0x00,0x00,0x0B,0xE2,0x00,0x00,0x7F,0x50,0x00,0x03,0xF9,0x00,0x00,0xBC,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0xBC,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0x2C,
+    0x94,0x00,0x00,0x00,0x07,0x40,0x00,0x6D,0xD3,0x05,0xDD,0x50,0x0B,0xF7,0x00,0x00,
+    0x29,0xE9,0x20,0x00,0x02,0x9F,0x91,0x00,0x00,0x2A,0x60,0x00,0x00,0x00,0xCF,0xFF,
+    0xFF,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xF1,0x19,0x10,
+    0x00,0x00,0x0B,0xE8,0x10,0x00,0x00,0x3B,0xE8,0x10,0x00,0x00,0x4E,0xE1,0x00,0x17,
+    0xEB,0x30,0x07,0xEC,0x40,0x00,0x1C,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0xEE,
+    0xA2,0x06,0x81,0x1B,0xB0,0x00,0x00,0x5F,0x00,0x00,0x08,0xE0,0x00,0x05,0xF6,0x00,
+    0x05,0xF6,0x00,0x00,0xA8,0x00,0x00,0x08,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0xD9,0x00,0x00,0x00,0x01,0x7C,0xEE,0xC6,0x00,0x00,0x04,0xD8,0x31,0x13,
+    0x9C,0x10,0x03,0xE3,0x00,0x00,0x00,0x6B,0x00,0xB6,0x00,0x4C,0xEE,0x50,0xC3,0x1E,
+    0x00,0x5D,0x51,0xD3,0x09,0x64,0xC0,0x0E,0x40,0x2E,0x00,0x97,0x4C,0x03,0xE0,0x06,
+    0xB0,0x0C,0x42,0xE0,0x2F,0x22,0xCB,0x17,0xC0,0x0C,0x60,0x9E,0xC3,0xBF,0xB1,0x00,
+    0x3E,0x30,0x00,0x00,0x00,0x00,0x00,0x5E,0x83,0x10,0x14,0x96,0x00,0x00,0x18,0xCE,
+    0xFE,0xB4,0x00,0x00,0x00,0x8F,0x70,0x00,0x00,0x00,0x1E,0xED,0x00,0x00,0x00,0x06,
+    0xF5,0xF4,0x00,0x00,0x00,0xCB,0x0C,0xA0,0x00,0x00,0x3F,0x50,0x6F,0x20,0x00,0x0A,
+    0xE0,0x01,0xE8,0x00,0x01,0xF8,0x00,0x09,0xE0,0x00,0x7F,0xFF,0xFF,0xFF,0x50,0x0D,
+    0xA0,0x00,0x00,0xCC,0x04,0xF4,0x00,0x00,0x05,0xF3,0xBC,0x00,0x00,0x00,0x0D,0x90,
+    0x9F,0xFF,0xFD,0x81,0x09,0xE0,0x01,0x4E,0xB0,0x9E,0x00,0x00,0x8F,0x09,0xE0,0x00,
+    0x08,0xE0,0x9E,0x00,0x15,0xE6,0x09,0xFF,0xFF,0xF9,0x10,0x9E,0x00,0x03,0xBD,0x19,
+    0xE0,0x00,0x02,0xF6,0x9E,0x00,0x00,0x3F,0x69,0xE0,0x00,0x3B,0xD1,0x9F,0xFF,0xFD,
+    0x92,0x00,0x00,0x04,0xAE,0xFE,0xB4,0x00,0x09,0xF7,0x20,0x27,0xD1,0x06,0xF4,0x00,
+    0x00,0x00,0x00,0xEA,0x00,0x00,0x00,0x00,0x3F,0x60,0x00,0x00,0x00,0x04,0xF5,0x00,
+    0x00,0x00,0x00,0x3F,0x60,0x00,0x00,0x00,0x00,0xEA,0x00,0x00,0x00,0x00,0x07,0xF4,
+    0x00,0x00,0x01,0x00,0x0B,0xE6,0x10,0x28,0xE1,0x00,0x06,0xCE,0xFD,0xA3,0x00,0x9F,
+    0xFF,0xFE,0xB5,0x00,0x09,0xE0,0x00,0x16,0xEA,0x00,0x9E,0x00,0x00,0x03,0xF8,0x09,
+    0xE0,0x00,0x00,0x09,0xE0,0x9E,0x00,0x00,0x00,0x5F,0x39,0xE0,0x00,0x00,0x04,0xF5,
+    0x9E,0x00,0x00,0x00,0x5F,0x39,0xE0,0x00,0x00,0x0A,0xE0,0x9E,0x00,0x00,0x03,0xF8,
+    0x09,0xE0,0x00,0x16,0xEA,0x00,0x9F,0xFF,0xFE,0xB5,0x00,0x00,0x9F,0xFF,0xFF,0xF7,
+    0x9E,0x00,0x00,0x00,0x9E,0x00,0x00,0x00,0x9E,0x00,0x00,0x00,0x9E,0x00,0x00,0x00,
+    0x9F,0xFF,0xFF,0x60,0x9E,0x00,0x00,0x00,0x9E,0x00,0x00,0x00,0x9E,0x00,0x00,0x00,
+    0x9E,0x00,0x00,0x00,0x9F,0xFF,0xFF,0xF7,0x9F,0xFF,0xFF,0xF7,0x9E,0x00,0x00,0x00,
+    0x9E,0x00,0x00,0x00,0x9E,0x00,0x00,0x00,0x9E,0x00,0x00,0x00,0x9F,0xFF,0xFF,0xA0,
+    0x9E,0x00,0x00,0x00,0x9E,0x00,0x00,0x00,0x9E,0x00,0x00,0x00,0x9E,0x00,0x00,0x00,
+    0x9E,0x00,0x00,0x00,0x00,0x04,0xAE,0xFE,0xC7,0x10,0x09,0xE7,0x20,0x26,0xD6,0x07,
+    0xF4,0x00,0x00,0x00,0x00,0xEA,0x00,0x00,0x00,0x00,0x3F,0x60,0x00,0x00,0x00,0x04,
+    0xF5,0x00,0x00,0x00,0x00,0x3F,0x60,0x00,0x0B,0xFF,0xB0,0xEB,0x00,0x00,0x00,0xAB,
+    0x07,0xF5,0x00,0x00,0x0A,0xB0,0x09,0xE7,0x20,0x14,0xDB,0x00,0x05,0xBE,0xFE,0xC8,
+    0x20,0x9E,0x00,0x00,0x00,0xDA,0x9E,0x00,0x00,0x00,0xDA,0x9E,0x00,0x00,0x00,0xDA,
+    0x9E,0x00,0x00,0x00,0xDA,0x9E,0x00,0x00,0x00,0xDA,0x9F,0xFF,0xFF,0xFF,0xFA,0x9E,
+    0x00,0x00,0x00,0xDA,0x9E,0x00,0x00,0x00,0xDA,0x9E,0x00,0x00,0x00,0xDA,0x9E,0x00,
+    0x00,0x00,0xDA,0x9E,0x00,0x00,0x00,0xDA,0x5F,0x45,0xF4,0x5F,0x45,0xF4,0x5F,0x45,
+    0xF4,0x5F,0x45,0xF4,0x5F,0x45,0xF4,0x5F,0x40,0x00,0x00,0xDB,0x00,0x00,0xDB,0x00,
+    0x00,0xDB,0x00,0x00,0xDB,0x00,0x00,0xDB,0x00,0x00,0xDB,0x00,0x00,0xDB,0x00,0x00,
+    0xDA,0x00,0x01,0xF7,0x00,0x1A,0xE1,0x6E,0xFB,0x30,0x7F,0x10,0x00,0x1B,0xD1,0x7F,
+    0x10,0x00,0xAE,0x20,0x7F,0x10,0x09,0xE3,0x00,0x7F,0x10,0x7F,0x40,0x00,0x7F,0x26,
+    0xF5,0x00,0x00,0x7F,0xFF,0xC0,0x00,0x00,0x7F,0x14,0xEA,0x00,0x00,0x7F,0x10,0x4F,
+    0x80,0x00,0x7F,0x10,0x05,0xF7,0x00,0x7F,0x10,0x00,0x6F,0x50,0x7F,0x10,0x00,0x08,
+    0xF4,0x9E,0x00,0x00,0x09,0xE0,0x00,0x00,0x9E,0x00,0x00,0x09,0xE0,0x00,0x00,0x9E,
+    0x00,0x00,0x09,0xE0,0x00,0x00,0x9E,0x00,0x00,0x09,0xE0,0x00,0x00,0x9E,0x00,0x00,
+    0x09,0xE0,0x00,0x00,0x9F,0xFF,0xFF,0xE0,0x9F,0x30,0x00,0x00,0x00,0x7F,0x59,0xFC,
+    0x00,0x00,0x00,0x2E,0xF5,0x9C,0xD6,0x00,0x00,0x0A,0xAF,0x59,0xB6,0xE1,0x00,0x03,
+    0xF3,0xF5,0x9B,0x0C,0x80,0x00,0xC8,0x1F,0x59,0xB0,0x4F,0x20,0x6E,0x11,0xF5,0x9B,
+    0x00,0xAB,0x1D,0x70,0x1F,0x59,0xB0,0x02,0xFB,0xD0,0x01,0xF5,0x9B,0x00,0x09,0xF5,
+    0x00,0x1F,0x59,0xB0,0x00,0x15,0x00,0x01,0xF5,0x9B,0x00,0x00,0x00,0x00,0x1F,0x50,
+    0x9D,0x10,0x00,0x00,0xAA,0x9F,0xA0,0x00,0x00,0xAA,0x9C,0xD7,0x00,0x00,0xAA,0x9B,
+    0x3E,0x40,0x00,0xAA,0x9B,0x06,0xD1,0x00,0xAA,0x9B,0x00,0xAB,0x00,0xAA,0x9B,0x00,
+    0x1D,0x80,0xAA,0x9B,0x00,0x02,0xE4,0xAA,0x9B,0x00,0x00,0x5E,0xCA,0x9B,0x00,0x00,
+    0x09,0xFA,0x9B,0x00,0x00,0x00,0xBA,0x00,0x04,0xBE,0xFD,0xA3,0x00,0x00,0x09,0xE7,
+    0x20,0x28,0xF6,0x00,0x06,0xF3,0x00,0x00,0x07,0xF3,0x00,0xEA,0x00,0x00,0x00,0x0D,
+    0xA0,0x2F,0x60,0x00,0x00,0x00,0xAE,0x04,0xF5,0x00,0x00,0x00,0x09,0xF0,0x3F,0x60,
+    0x00,0x00,0x00,0xAE,0x00,0xEA,0x00,0x00,0x00,0x0D,0xA0,0x07,0xF4,0x00,0x00,0x07,
+    0xF3,0x00,0x09,0xE6,0x10,0x28,0xF6,0x00,0x00,0x05,0xBE,0xFD,0xA3,0x00,0x00,0x7F,
+    0xFF,0xFC,0x70,0x07,0xF1,0x01,0x6F,0x90,0x7F,0x10,0x00,0x8F,0x17,0xF1,0x00,0x06,
+    0xF3,0x7F,0x10,0x00,0x9F,0x17,0xF1,0x01,0x7F,0x80,0x7F,0xFF,0xEC,0x60,0x07,0xF1,
+    0x00,0x00,0x00,0x7F,0x10,0x00,0x00,0x07,0xF1,0x00,0x00,0x00,0x7F,0x10,0x00,0x00,
+    0x00,0x00,0x04,0xBE,0xFD,0x93,0x00,0x00,0x09,0xE7,0x20,0x28,0xF5,0x00,0x06,0xF3,
+    0x00,0x00,0x07,0xF3,0x00,0xEA,0x00,0x00,0x00,0x0D,0xA0,0x2F,0x60,0x00,0x00,0x00,
+    0xAE,0x04,0xF5,0x00,0x00,0x00,0x09,0xF0,0x3F,0x60,0x00,0x00,0x00,0xAE,0x00,0xEA,
+    0x00,0x00,0x00,0x0D,0xB0,0x07,0xF4,0x00,0x00,0x07,0xF4,0x00,0x09,0xE6,0x10,0x28,
+    0xF8,0x00,0x00,0x05,0xBE,0xFE,0xED,0x00,0x00,0x00,0x00,0x00,0x02,0xE9,0x00,0x00,
+    0x00,0x00,0x00,0x06,0xF6,0x00,0x00,0x00,0x00,0x00,0x09,0xE3,0x7F,0xFF,0xEC,0x70,
+    0x07,0xF1,0x01,0x6F,0x90,0x7F,0x10,0x00,0x9E,0x07,0xF1,0x00,0x0A,0xD0,0x7F,0x10,
+    0x17,0xF5,0x07,0xFF,0xFF,0xB3,0x00,0x7F,0x11,0xDC,0x00,0x07,0xF1,0x03,0xF8,0x00,
+    0x7F,0x10,0x07,0xF4,0x07,0xF1,0x00,0x0C,0xD1,0x7F,0x10,0x00,0x2E,0xA0,0x00,0x7D,
+    0xED,0xA2,0x08,0xD3,0x13,0xA5,0x0E,0x70,0x00,0x00,0x0E,0xB0,0x00,0x00,0x09,0xFD,
+    0x83,0x00,0x00,0x7D,0xFF,0xB1,0x00,0x00,0x3A,0xF9,0x00,0x00,0x00,0xBD,0x01,0x00,
+    0x00,0xAB,0x5E,0x61,0x16,0xF4,0x06,0xCE,0xFC,0x40,0xCF,0xFF,0xFF,0xFF,0xF3,0x00,
+    0x01,0xF8,0x00,0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0x01,
+    0xF8,0x00,0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0x01,0xF8,
+    0x00,0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0x01,0xF8,0x00,
+    0x00,0xBC,0x00,0x00,0x02,0xF6,0xBC,0x00,0x00,0x02,0xF6,0xBC,0x00,0x00,0x02,0xF6,
+    0xBC,0x00,0x00,0x02,0xF6,0xBC,0x00,0x00,0x02,0xF6,0xBC,0x00,0x00,0x02,0xF6,0xBC,
+    0x00,0x00,0x02,0xF6,0x9E,0x00,0x00,0x04,0xF5,0x5F,0x40,0x00,0x09,0xE1,0x0A,0xE5,
+    0x12,0x7F,0x60,0x00,0x6C,0xFE,0xB3,0x00,0xBD,0x00,0x00,0x00,0x1E,0x95,0xF5,0x00,
+    0x00,0x07,0xF3,0x0D,0xB0,0x00,0x00,0xDB,0x00,0x7F,0x20,0x00,0x4F,0x50,0x01,0xE8,
+    0x00,0x0A,0xD0,0x00,0x09,0xE1,0x02,0xF7,0x00,0x00,0x3F,0x60,0x8F,0x10,0x00,0x00,
+    0xBC,0x0E,0x90,0x00,0x00,0x05,0xF8,0xF3,0x00,0x00,0x00,0x0D,0xFC,0x00,0x00,0x00,
+    0x00,0x7F,0x50,0x00,0x00,0xBE,0x00,0x00,0x08,0xE1,0x00,0x00,0x8F,0x16,0xF4,0x00,
+    0x00,0xEF,0x50,0x00,0x0D,0xA0,0x1F,0x90,0x00,0x5F,0xCB,0x00,0x03,0xF6,0x00,0xBD,
+    0x00,0x0A,0xA6,0xF1,0x00,0x8F,0x10,0x06,0xF3,0x01,0xE5,0x1F,0x60,0x0D,0xB0,0x00,
+    0x2F,0x80,0x6E,0x10,0xAB,0x02,0xF6,0x00,0x00,0xCC,0x0B,0xA0,0x05,0xF2,0x7F,0x10,
+    0x00,0x07,0xF3,0xF4,0x00,0x1E,0x7C,0xB0,0x00,0x00,0x2F,0xCE,0x00,0x00,0xAC,0xF6,
+    0x00,0x00,0x00,0xCF,0x90,0x00,0x05,0xFF,0x20,0x00,0x00,0x07,0xF4,0x00,0x00,0x0E,
+    0xC0,0x00,0x00,0x6F,0x60,0x00,0x01,0xDA,0x00,0xAE,0x10,0x00,0xAD,0x10,0x01,0xDA,
+    0x00,0x5F,0x40,0x00,0x04,0xF5,0x1E,0x80,0x00,0x00,0x08,0xEA,0xC0,0x00,0x00,0x00,
+    0x2F,0xF7,0x00,0x00,0x00,0x0B,0xC8,0xE2,0x00,0x00,0x07,0xE2,0x0D,0xB0,0x00,0x03,
+    0xF7,0x00,0x3F,0x70,0x00,0xCB,0x00,0x00,0x9E,0x20,0x8E,0x20,0x00,0x01,0xDC,0x00,
+    0x9E,0x20,0x00,0x01,0xDA,0x1E,0xA0,0x00,0x09,0xE2,0x05,0xF4,0x00,0x3F,0x60,0x00,
+    0xBD,0x00,0xCC,0x00,0x00,0x2E,0x76,0xF3,0x00,0x00,0x07,0xEE,0x80,0x00,0x00,0x00,
+    0xDE,0x00,0x00,0x00,0x00,0xBC,0x00,0x00,0x00,0x00,0xBC,0x00,0x00,0x00,0x00,0xBC,
+    0x00,0x00,0x00,0x00,0xBC,0x00,0x00,0x0F,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,0x2E,
+    0xD1,0x00,0x00,0x00,0xBF,0x30,0x00,0x00,0x07,0xF7,0x00,0x00,0x00,0x3F,0xB0,0x00,
+    0x00,0x01,0xDE,0x10,0x00,0x00,0x0A,0xF4,0x00,0x00,0x00,0x6F,0x80,0x00,0x00,0x02,
+    0xEC,0x00,0x00,0x00,0x0C,0xE2,0x00,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xF4,0xDF,0xF1,
+    0xD5,0x00,0xD5,0x00,0xD5,0x00,0xD5,0x00,0xD5,0x00,0xD5,0x00,0xD5,0x00,0xD5,0x00,
+    0xD5,0x00,0xD5,0x00,0xD5,0x00,0xD5,0x00,0xDF,0xF1,0x0D,0x30,0x00,0x00,0x89,0x00,
+    0x00,0x02,0xE1,0x00,0x00,0x0B,0x70,0x00,0x00,0x4D,0x00,0x00,0x00,0xD4,0x00,0x00,
+    0x07,0xB0,0x00,0x00,0x1E,0x20,0x00,0x00,0x98,0x00,0x00,0x03,0xE1,0x00,0x00,0x0C,
+    0x60,0x00,0x00,0x5C,0x4F,0xFA,0x00,0x8A,0x00,0x8A,0x00,0x8A,0x00,0x8A,0x00,0x8A,
+    0x00,0x8A,0x00,0x8A,0x00,0x8A,0x00,0x8A,0x00,0x8A,0x00,0x8A,0x00,0x8A,0x4F,0xFA,
+    0x00,0x3F,0x50,0x00,0x0B,0xDD,0x00,0x05,0xE2,0xC7,0x00,0xD7,0x04,0xE1,0x7D,0x00,
+    0x0A,0x90,0xFF,0xFF,0xFF,0x40,0x4E,0x60,0x03,0xD2,0x02,0xAE,0xEB,0x20,0x0A,0x92,
+    0x1C,0xC0,0x00,0x00,0x06,0xF1,0x00,0x00,0x04,0xF2,0x02,0x9C,0xEF,0xF2,0x1E,0x93,
+    0x14,0xF2,0x3F,0x50,0x2A,0xF2,0x08,0xEE,0xA3,0xE2,0xCA,0x00,0x00,0x00,0xCA,0x00,
+    0x00,0x00,0xCA,0x00,0x00,0x00,0xCA,0x6D,0xEB,0x20,0xCE,0x71,0x2C,0xC0,0xCA,0x00,
+    0x05,0xF3,0xCA,0x00,0x02,0xF5,0xCA,0x00,0x03,0xF4,0xCA,0x00,0x06,0xF2,0xCE,0x41,
+    0x4E,0x90,0xC8,0xAE,0xE8,0x00,0x00,0x8D,0xEC,0x60,0x09,0xD4,0x13,0x70,0x2F,0x50,
+    0x00,0x00,0x5F,0x20,0x00,0x00,0x6F,0x20,0x00,0x00,0x3F,0x50,0x00,0x00,0x0A,0xD4,
+    0x14,0xA0,0x00,0x8E,0xFC,0x60,0x00,0x00,0x00,0xBB,0x00,0x00,0x00,0xBB,0x00,0x00,
+    0x00,0xBB,0x00,0x9E,0xE9,0xCB,0x0A,0xD3,0x15,0xEB,0x2F,0x50,0x00,0xBB,0x5F,0x20,
+    0x00,0xBB,0x5F,0x10,0x00,0xBB,0x3F,0x40,0x00,0xBB,0x0C,0xC2,0x17,0xEB,0x02,0xBE,
+    0xD6,0x8B,0x00,0x7D,0xEC,0x40,0x0A,0xC3,0x15,0xE3,0x2F,0x30,0x00,0xA9,0x5F,0xFF,
+    0xFF,0xFA,0x5F,0x10,0x00,0x00,0x2F,0x50,0x00,0x00,0x09,0xD4,0x12,0x84,0x00,0x7D,
+    0xFD,0x91,0x00,0x7D,0xE3,0x05,0xF4,0x00,0x08,0xD0,0x00,0xBF,0xFF,0xF3,0x08,0xE0,
+    0x00,0x08,0xE0,0x00,0x08,0xE0,0x00,0x08,0xE0,0x00,0x08,0xE0,0x00,0x08,0xE0,0x00,
+    0x08,0xE0,0x00,0x03,0xBE,0xFF,0xFE,0x0D,0x91,0x2B,0xD3,0x2F,0x30,0x06,0xD0,0x0D,
+    0x91,0x2B,0xA0,0x04,0xEE,0xE9,0x10,0x0A,0x60,0x00,0x00,0x0D,0x91,0x00,0x00,0x08,
+    0xEF,0xFE,0xC3,0x5C,0x10,0x02,0xCA,0x7D,0x30,0x14,0xD6,0x08,0xDE,0xEC,0x50,0xC9,
+    0x00,0x00,0x0C,0x90,0x00,0x00,0xC9,0x00,0x00,0x0C,0x97,0xEE,0xA1,0xCF,0x71,0x3E,
+    0x9C,0x90,0x00,0x9D,0xC9,0x00,0x08,0xEC,0x90,0x00,0x8E,0xC9,0x00,0x08,0xEC,0x90,
+    0x00,0x8E,0xC9,0x00,0x08,0xE0,0xBC,0x00,0x00,0x00,0x0A,0xB0,0xAB,0x0A,0xB0,0xAB,
+    0x0A,0xB0,0xAB,0x0A,0xB0,0xAB,0x00,0x00,0xBC,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,
+    0xB0,0x00,0xAB,0x00,0x0A,0xB0,0x00,0xAB,0x00,0x0A,0xB0,0x00,0xAB,0x00,0x0A,0xB0,
+    0x00,0xAB,0x00,0x0A,0xB0,0x01,0xD9,0x06,0xFB,0x20,0xCA,0x00,0x00,0x00,0xCA,0x00,
+    0x00,0x00,0xCA,0x00,0x00,0x00,0xCA,0x00,0x3E,0x60,0xCA,0x03,0xE6,0x00,0xCA,0x4E,
+    0x60,0x00,0xCF,0xFB,0x00,0x00,0xCA,0x4F,0x60,0x00,0xCA,0x06,0xF3,0x00,0xCA,0x00,
+    0x9D,0x10,0xCA,0x00,0x1C,0xB0,0xAB,0xAB,0xAB,0xAB,0xAB,0xAB,0xAB,0xAB,0xAB,0xAB,
+    0xAB,0xC6,0x9E,0xD3,0x4C,0xEC,0x30,0xCE,0x51,0x8D,0xC2,0x1B,0xC0,0xC9,0x00,0x2F,
+    0x60,0x05,0xF1,0xC9,0x00,0x1F,0x50,0x04,0xF2,0xC9,0x00,0x1F,0x50,0x04,0xF2,0xC9,
+    0x00,0x1F,0x50,0x04,0xF2,0xC9,0x00,0x1F,0x50,0x04,0xF2,0xC9,0x00,0x1F,0x50,0x04,
+    0xF2,0xC6,0x7E,0xEA,0x1C,0xE7,0x13,0xE9,0xC9,0x00,0x09,0xDC,0x90,0x00,0x8E,0xC9,
+    0x00,0x08,0xEC,0x90,0x00,0x8E,0xC9,0x00,0x08,0xEC,0x90,0x00,0x8E,0x00,0x7D,0xFD,
+    0x60,0x00,0x9D,0x31,0x4E,0x80,0x3F,0x50,0x00,0x7F,0x16,0xF2,0x00,0x04,0xF4,0x6F,
+    0x10,0x00,0x3F,0x43,0xF5,0x00,0x07,0xF1,0x0A,0xD3,0x14,0xE8,0x00,0x07,0xDF,0xD6,
+    0x00,0xC6,0x7D,0xFA,0x10,0xCE,0x61,0x3D,0xB0,0xC9,0x00,0x06,0xF2,0xC9,0x00,0x03,
+    0xF4,0xC9,0x00,0x03,0xF3,0xC9,0x00,0x07,0xF1,0xCD,0x41,0x4E,0x80,0xCB,0xBE,0xE8,
+    0x00,0xC9,0x00,0x00,0x00,0xC9,0x00,0x00,0x00,0xC9,0x00,0x00,0x00,0x00,0x9E,0xEA,
+    0x9B,0x0A,0xD3,0x15,0xEB,0x2F,0x50,0x00,0xBB,0x5F,0x20,0x00,0xBB,0x5F,0x10,0x00,
+    0xBB,0x3F,0x40,0x00,0xBB,0x0C,0xC2,0x17,0xFB,0x02,0xBE,0xD6,0xBB,0x00,0x00,0x00,
+    0xBB,0x00,0x00,0x00,0xBB,0x00,0x00,0x00,0xBB,0xC6,0x9E,0xE0,0xCE,0x71,0x00,0xCB,
+    0x00,0x00,0xC9,0x00,0x00,0xC9,0x00,0x00,0xC9,0x00,0x00,0xC9,0x00,0x00,0xC9,0x00,
+    0x00,0x04,0xCE,0xD7,0x02,0xF6,0x12,0x60,0x3F,0x40,0x00,0x00,0xBF,0xB6,0x10,0x00,
+    0x38,0xED,0x10,0x00,0x03,0xF3,0x38,0x21,0x7E,0x11,0x9E,0xEB,0x30,0x00,0x70,0x00,
+    0x01,0xF1,0x00,0x04,0xF1,0x00,0x8F,0xFF,0xF6,0x06,0xF1,0x00,0x06,0xF1,0x00,0x06,
+    0xF1,0x00,0x06,0xF1,0x00,0x06,0xF1,0x00,0x04,0xF4,0x21,0x00,0xAE,0xD4,0x0F,0x60,
+    0x00,0xBB,0x0F,0x60,0x00,0xBB,0x0F,0x60,0x00,0xBB,0x0F,0x60,0x00,0xBB,0x0F,0x60,
+    0x00,0xBB,0x0E,0x70,0x00,0xBB,0x0B,0xD2,0x17,0xFB,0x02,0xBE,0xD7,0x8B,0xAC,0x00,
+    0x00,0x8D,0x4F,0x30,0x01,0xE6,0x0C,0x90,0x06,0xE1,0x06,0xE1,0x0C,0x90,0x01,0xE6,
+    0x3F,0x30,0x00,0x9C,0x9C,0x00,0x00,0x3F,0xE5,0x00,0x00,0x0B,0xE0,0x00,0xBB,0x00,
+    0x09,0xE0,0x00,0x6E,0x16,0xF1,0x00,0xEF,0x40,0x0B,0xA0,0x1F,0x50,0x4E,0xA9,0x01,
+    0xF5,0x00,0xB9,0x09,0x95,0xE0,0x5E,0x10,0x06,0xE0,0xE4,0x0E,0x4A,0xA0,0x00,0x1F,
+    0x7D,0x00,0xA8,0xE5,0x00,0x00,0xBE,0x80,0x05,0xEF,0x10,0x00,0x06,0xF3,0x00,0x0E,
+    0xA0,0x00,0x5F,0x40,0x02,0xE5,0x09,0xD1,0x0C,0xA0,0x01,0xD9,0x7D,0x10,0x00,0x4F,
+    0xE4,0x00,0x00,0x5E,0xF6,0x00,0x01,0xE7,0x7E,0x20,0x0B,0xC0,0x0C,0xC0,0x6E,0x20,
+    0x02,0xE7,0xAD,0x00,0x00,0x8D,0x04,0xF4,0x00,0x1E,0x60,0x0C,0xA0,0x06,0xE1,0x00,
+    0x6F,0x20,0xC9,0x00,0x00,0xE8,0x3F,0x20,0x00,0x08,0xE9,0xB0,0x00,0x00,0x2F,0xF5,
+    0x00,0x00,0x00,0xAD,0x00,0x00,0x00,0x0D,0x70,0x00,0x00,0x05,0xE1,0x00,0x00,0x00,
+    0xC9,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xC0,0x00,0x03,0xF5,0x00,0x01,0xD9,0x00,0x00,
+    0xAC,0x10,0x00,0x7E,0x20,0x00,0x3F,0x50,0x00,0x1D,0x90,0x00,0x06,0xFF,0xFF,0xFA,
+    0x03,0xCE,0x10,0xC9,0x00,0x0E,0x50,0x00,0xC6,0x00,0x09,0x90,0x01,0xB8,0x00,0xAD,
+    0x10,0x01,0xB7,0x00,0x09,0x90,0x00,0xB8,0x00,0x0D,0x50,0x00,0xE5,0x00,0x0B,0xA1,
+    0x00,0x2B,0xE1,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,
+    0x2E,0x2E,0x4E,0xA1,0x00,0x1C,0x90,0x00,0x8B,0x00,0x09,0x90,0x00,0xC6,0x00,0x0C,
+    0x80,0x00,0x3E,0x70,0x0A,0x90,0x00,0xD6,0x00,0x0B,0x80,0x00,0x9A,0x00,0x08,0xB0,
+    0x01,0xC8,0x04,0xEA,0x10,0x00,0x00,0x00,0x06,0x20,0x4D,0xE9,0x23,0xF2,0x0D,0x61,
+    0x7D,0xE7,0x00,0x81,0x00,0x00,0x00,
+};
+
+static const FONT_Glyph_t font_sans16_glyphs[95] = {
+    {    0,   0,   0,    0,    0,   3}, // ' '
+    {    0,   3,  11,    1,  -11,   5}, // '!'
+    {   17,   5,   4,    1,  -11,   6}, // '"'
+    {   27,   9,  11,    0,  -11,   9}, // '#'
+    {   77,   9,  15,    0,  -13,   9}, // '$'
+    {  145,  12,  11,    0,  -11,  13}, // '%'
+    {  211,  12,  11,    0,  -11,  11}, // '&'
+    {  277,   2,   4,    1,  -11,   4}, // "'"
+    {  281,   4,  16,    1,  -13,   5}, // '('
+    {  313,   4,  16,    0,  -13,   5}, // ')'
+    {  345,   6,   5,    0,  -11,   6}, // '*'
+    {  360,   9,   8,    0,   -9,   9}, // '+'
+    {  396,   3,   4,    0,   -1,   3}, // ','
+    {  402,   5,   1,    0,   -5,   6}, // '-'
+    {  405,   3,   1,    0,   -1,   3}, // '.'
+    {  407,   8,  12,   -1,  -11,   6}, // '/'
+    {  455,   9,  11,    0,  -11,   9}, // '0'
+    {  505,   8,  11,    1,  -11,   9}, // '1'
+    {  549,   9,  11,    0,  -11,   9}, // '2'
+    {  599,   9,  11,    0,  -11,   9}, // '3'
+    {  649,   9,  11,    0,  -11,   9}, // '4'
+    {  699,   9,  11,    0,  -11,   9}, // '5'
+    {  749,   9,  11,    0,  -11,   9}, // '6'
+    {  799,   9,  11,    0,  -11,   9}, // '7'
+    {  849,   9,  11,    0,  -11,   9}, // '8'
+    {  899,   8,  11,    1,  -11,   9}, // '9'
+    {  943,   2,   8,    1,   -8,   4}, // ':'
+    {  951,   2,  11,    1,   -8,   4}, // ';'
+    {  962,   7,   8,    1,   -9,   9}, // '<'
+    {  990,   8,   4,    1,   -7,   9}, // '='
+    { 1006,   8,   8,    1,   -9,   9}, // '>'
+    { 1038,   7,  11,    0,  -11,   6}, // '?'
+    { 1077,  13,  12,    0,  -10,  13}, // '@'
+    { 1155,  11,  11,    0,  -11,  11}, // 'A'
+    { 1216,   9,  11,    1,  -11,  10}, // 'B'
+    { 1266,  11,  11,    0,  -11,  11}, // 'C'
+    { 1327,  11,  11,    1,  -11,  12}, // 'D'
+    { 1388,   8,  11,    1,  -11,   9}, // 'E'
+    { 1432,   8,  11,    1,  -11,   9}, // 'F'
+    { 1476,  11,  11,    0,  -11,  12}, // 'G'
+    { 1537,  10,  11,    1,  -11,  12}, // 'H'
+    { 1592,   3,  11,    1,  -11,   5}, // 'I'
+    { 1609,   6,  11,    0,  -11,   7}, // 'J'
+    { 1642,  10,  11,    1,  -11,  11}, // 'K'
+    { 1697,   7,  11,    1,  -11,   8}, // 'L'
+    { 1736,  13,  11,    1,  -11,  15}, // 'M'
+    { 1808,  10,  11,    1,  -11,  12}, // 'N'
+    { 1863,  13,  11,    0,  -11,  13}, // 'O'
+    { 1935,   9,  11,    1,  -11,  10}, // 'P'
+    { 1985,  13,  14,    0,  -11,  13}, // 'Q'
+    { 2076,   9,  11,    1,  -11,  10}, // 'R'
+    { 2126,   8,  11,    0,  -11,   8}, // 'S'
+    { 2170,  10,  11,    0,  -11,   9}, // 'T'
+    { 2225,  10,  11,    1,  -11,  12}, // 'U'
+    { 2280,  11,  11,    0,  -11,  11}, // 'V'
+    { 2341,  17,  11,    0,  -11,  16}, // 'W'
+    { 2435,  11,  11,    0,  -11,  10}, // 'X'
+    { 2496,  10,  11,    0,  -11,  10}, // 'Y'
+    { 2551,  10,  11,    0,  -11,  10}, // 'Z'
+    { 2606,   4,  14,    1,  -12,   5}, // '['
+    { 2634,   7,  12,   -1,  -11,   6}, // '\\'
+    { 2676,   4,  14,    0,  -12,   5}, // ']'
+    { 2704,   7,   5,    1,  -11,   9}, // '^'
+    { 2722,   7,   1,    0,    1,   6}, // '_'
+    { 2726,   4,   2,    0,  -11,   5}, // '`'
+    { 2730,   8,   8,    0,   -8,   8}, // 'a'
+    { 2762,   8,  11,    1,  -11,   9}, // 'b'
+    { 2806,   8,   8,    0,   -8,   7}, // 'c'
+    { 2838,   8,  11,    0,  -11,   9}, // 'd'
+    { 2882,   8,   8,    0,   -8,   8}, // 'e'
+    { 2914,   6,  11,    0,  -11,   5}, // 'f'
+    { 2947,   8,  11,    0,   -8,   8}, // 'g'
+    { 2991,   7,  11,    1,  -11,   9}, // 'h'
+    { 3030,   3,  11,    1,  -11,   4}, // 'i'
+    { 3047,   5,  14,   -1,  -11,   4}, // 'j'
+    { 3082,   8,  11,    1,  -11,   8}, // 'k'
+    { 3126,   2,  11,    1,  -11,   4}, // 'l'
+    { 3137,  12,   8,    1,   -8,  13}, // 'm'
+    { 3185,   7,   8,    1,   -8,   9}, // 'n'
+    { 3213,   9,   8,    0,   -8,   9}, // 'o'
+    { 3249,   8,  11,    1,   -8,   9}, // 'p'
+    { 3293,   8,  11,    0,   -8,   9}, // 'q'
+    { 3337,   6,   8,    1,   -8,   6}, // 'r'
+    { 3361,   7,   8,    0,   -8,   7}, // 's'
+    { 3389,   6,  11,    0,  -11,   6}, // 't'
+    { 3422,   8,   8,    0,   -8,   9}, // 'u'
+    { 3454,   8,   8,    0,   -8,   8}, // 'v'
+    { 3486,  13,   8,    0,   -8,  12}, // 'w'
+    { 3538,   8,   8,    0,   -8,   8}, // 'x'
+    { 3570,   9,  11,    0,   -8,   8}, // 'y'
+    { 3620,   7,   8,    0,   -8,   7}, // 'z'
+    { 3648,   5,  14,    0,  -12,   5}, // '{'
+    { 3683,   2,  15,    1,  -12,   5}, // '|'
+    { 3698,   5,  14,    0,  -12,   5}, // '}'
+    { 3733,   9,   4,    0,   -7,   9}, // '~'
+};
+
+const FONT_t font_sans16 = {
+    .bitmap = font_sans16_bitmap, .glyphs = font_sans16_glyphs,
+    .first = 32, .last = 126, .height = 19, .baseline = 16, .bpp = 4
+};
@@ -10,7 +10,6 @@ void delay(volatile uint32_t count) {
 
 int main(void) {
     // Initialize SPI2 and display
-    SPI2_GPIO_Init();
     ST7789_Init();
 
     mini_printf("=== ST7789 API Test Started ===\r\n");
@@ -1,7 +1,7 @@
 #include "stm32f103xb.h"
 #include "adc.h"
 #include "uart.h"
-#include <stdio.h>  // for snprintf
+#include "utility.h"  // for mini_snprintf
 
 int main(void) {
     uint16_t adc_value;
@@ -42,7 +42,7 @@ int main(void) {
         millivolts = (adc_value * 3300) / 4095;
 
         // Format string safely
-        snprintf(buffer, sizeof(buffer), "ADC: %u, Voltage: %u mV\r\n", adc_value, millivolts);
+        mini_snprintf(buffer, sizeof(buffer), "ADC: %u, Voltage: %u mV\r\n", adc_value, millivolts);
 
         // Send string over UART2
         UART_WriteString(USART2, buffer);
@@ -1,7 +1,7 @@
 #include "stm32f103xb.h"
 #include "uart.h"
 #include "bkp.h"
-#include <stdio.h>  // <-- for sprintf
+#include "utility.h"  // for mini_snprintf
 
 UART_Config_t uart2_cfg = {
     .baudRate    = 115200,
@@ -22,15 +22,15 @@ int main(void)
 
     uint16_t previousValue = BKP_ReadReg(BKP_DR1);
 
-    // ✅ Use sprintf for cleaner formatting
+    // ✅ Use mini_snprintf for cleaner formatting
     char msg[64];
-    sprintf(msg, "Previous BKP_DR1 value: 0x%04X\r\n", previousValue);
+    mini_snprintf(msg, sizeof(msg), "Previous BKP_DR1 value: 0x%04X\r\n", previousValue);
     UART_WriteString(USART2, msg);
 
     uint16_t newValue = 0x55AA;
     BKP_WriteReg(BKP_DR1, newValue);
 
-    sprintf(msg, "New BKP_DR1 value written: 0x%04X\r\n", newValue);
+    mini_snprintf(msg, sizeof(msg), "New BKP_DR1 value written: 0x%04X\r\n", newValue);
     UART_WriteString(USART2, msg);
 
     UART_WriteString(USART2, "Reset the MCU to test persistence\r\n");
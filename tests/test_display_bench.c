@@ -0,0 +1,166 @@
+#include "stm32f103xb.h"
+#include "display_st7789.h"
+#include "dwt.h"
+#include "utility.h"   // for mini_printf
+#include <stdint.h>
+
+// Display throughput benchmark.
+// Runs a fixed set of drawing workloads and prints one CSV line per workload
+// on USART2 (115200 8N1):
+//   BENCH,<name>,<ops>,<cycles>,<us>,<pixels>,<bytes>,<commands>,<pixels/s>,<bytes/s>
+// Logs from two builds can be compared with tools/bench_compare.py.
+// The same file runs on the host against a model of the bus: make bench-host
+
+// ----------------- Workload data -----------------
+#define BENCH_IMAGE_SIDE  64
+#define BENCH_SPRITE_SIDE 32
+
+// Per row: run of 16, 16 literals, run of 32 → 4 + 16 + 2 words
+static uint16_t image_data[BENCH_IMAGE_SIDE * 20];
+static const ST7789_Image_t bench_image = {
+    .width = BENCH_IMAGE_SIDE, .height = BENCH_IMAGE_SIDE,
+    .data = image_data, .length = sizeof(image_data) / sizeof(image_data[0])
+};
+
+// 4-bit disc with a transparent background
+static uint8_t sprite_pixels[BENCH_SPRITE_SIDE * BENCH_SPRITE_SIDE / 2];
+static const uint16_t sprite_palette[16] = {
+    0, ST7789_COLOR_RED, ST7789_COLOR_GREEN, ST7789_COLOR_BLUE,
+    ST7789_COLOR_YELLOW, ST7789_COLOR_CYAN, ST7789_COLOR_MAGENTA, ST7789_COLOR_WHITE
+};
+static const ST7789_Sprite_t bench_sprite = {
+    .width = BENCH_SPRITE_SIDE, .height = BENCH_SPRITE_SIDE, .bpp = 4,
+    .flags = ST7789_SPRITE_KEYED, .key = 0,
+    .pixels = sprite_pixels, .palette = sprite_palette
+};
+
+static void Bench_BuildData(void) {
+    uint16_t *w = image_data;
+    for(uint16_t y = 0; y < BENCH_IMAGE_SIDE; y++) {
+        *w++ = ST7789_RLE_RUN | 15;
+        *w++ = ST7789_COLOR_BLUE;
+        *w++ = 15;                                   // 16 literals
+        for(uint16_t x = 0; x < 16; x++) *w++ = (uint16_t)(x * 0x0841 + y);
+        *w++ = ST7789_RLE_RUN | 31;
+        *w++ = ST7789_COLOR_GREEN;
+    }
+
+    int16_t c = BENCH_SPRITE_SIDE / 2, r2 = (BENCH_SPRITE_SIDE / 2 - 1) * (BENCH_SPRITE_SIDE / 2 - 1);
+    for(int16_t y = 0; y < BENCH_SPRITE_SIDE; y++) {
+        for(int16_t x = 0; x < BENCH_SPRITE_SIDE; x++) {
+            int16_t dx = x - c, dy = y - c;
+            uint8_t idx = (dx * dx + dy * dy <= r2) ? (uint8_t)(1 + ((x + y) >> 3) % 7) : 0;
+            uint8_t *b = &sprite_pixels[(y * BENCH_SPRITE_SIDE + x) / 2];
+            *b |= (x & 1) ? idx : (uint8_t)(idx << 4);
+        }
+    }
+}
+
+// ----------------- Workloads -----------------
+static void Bench_FillScreen(void) {
+    static const uint16_t colors[4] = {ST7789_COLOR_RED, ST7789_COLOR_GREEN, ST7789_COLOR_BLUE, ST7789_COLOR_BLACK};
+    for(uint8_t i = 0; i < 4; i++) ST7789_FillScreen(colors[i]);
+}
+
+static uint32_t lcg = 12345;
+static uint16_t Bench_Random(uint16_t range) {
+    lcg = lcg * 1664525 + 1013904223;
+    return (uint16_t)((lcg >> 16) % range);
+}
+
+static void Bench_Pixels(void) {
+    for(uint8_t i = 0; i < 100; i++)
+        ST7789_DrawPixel(Bench_Random(ST7789_WIDTH), Bench_Random(ST7789_HEIGHT), ST7789_COLOR_WHITE);
+}
+
+static const char bench_line[] = "The quick brown fox jumps over!";   // 31 chars + space
+
+static void Bench_Text(void) {
+    for(uint8_t i = 0; i < 32; i++)
+        ST7789_DrawString(0, (i * 8) % ST7789_HEIGHT, bench_line, ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
+}
+
+static void Bench_TextScaled(void) {
+    for(uint8_t i = 0; i < 64; i++)
+        ST7789_DrawStringScaled(0, (i * 16) % (ST7789_HEIGHT - 15), "Scaled text x2!!", ST7789_COLOR_YELLOW, ST7789_COLOR_BLACK, 2);
+}
+
+static void Bench_Rect8(void) {
+    for(uint8_t i = 0; i < 100; i++)
+        ST7789_FillRect(Bench_Random(ST7789_WIDTH - 8), Bench_Random(ST7789_HEIGHT - 8), 8, 8, ST7789_COLOR_CYAN);
+}
+
+static void Bench_Rect32(void) {
+    for(uint8_t i = 0; i < 50; i++)
+        ST7789_FillRect(Bench_Random(ST7789_WIDTH - 32), Bench_Random(ST7789_HEIGHT - 32), 32, 32, ST7789_COLOR_MAGENTA);
+}
+
+static void Bench_Rect100(void) {
+    for(uint8_t i = 0; i < 10; i++)
+        ST7789_FillRect(Bench_Random(ST7789_WIDTH - 100), Bench_Random(ST7789_HEIGHT - 100), 100, 100, ST7789_COLOR_RED);
+}
+
+static void Bench_Image(void) {
+    for(uint8_t i = 0; i < 10; i++)
+        ST7789_DrawImage(i * 16, i * 16, &bench_image);
+}
+
+static void Bench_Sprite(void) {
+    for(uint8_t i = 0; i < 20; i++)
+        ST7789_DrawSprite((int16_t)(i * 10), (int16_t)(i * 10), &bench_sprite);
+}
+
+// ----------------- Runner -----------------
+typedef struct {
+    const char *name;
+    void (*run)(void);
+    uint16_t ops;               // draw calls per run, for per-op figures
+} Bench_t;
+
+static const Bench_t benches[] = {
+    {"fill_screen", Bench_FillScreen, 4},
+    {"pixels_100",  Bench_Pixels,     100},
+    {"text_1k",     Bench_Text,       32},
+    {"text_1k_x2",  Bench_TextScaled, 64},
+    {"rect_8",      Bench_Rect8,      100},
+    {"rect_32",     Bench_Rect32,     50},
+    {"rect_100",    Bench_Rect100,    10},
+    {"image_64",    Bench_Image,      10},
+    {"sprite_32",   Bench_Sprite,     20},
+};
+
+static void Bench_Run(const Bench_t *b) {
+    ST7789_Stats_t st;
+
+    ST7789_ResetStats();
+    uint32_t start = DWT_GetCycles();
+    b->run();
+    while(ST7789_IsBusy());                 // async fills count until they finish
+    uint32_t cycles = DWT_GetCycles() - start;
+    ST7789_GetStats(&st);
+
+    // 64-bit intermediates: cycles * 1e6 overflows 32 bits after ~4 ms at 72 MHz
+    uint32_t us = (uint32_t)((uint64_t)cycles * 1000000U / SystemCoreClock);
+    uint32_t pps = cycles ? (uint32_t)((uint64_t)st.pixels * SystemCoreClock / cycles) : 0;
+    uint32_t bps = cycles ? (uint32_t)((uint64_t)st.bytes * SystemCoreClock / cycles) : 0;
+
+    mini_printf("BENCH,%s,%u,%u,%u,%u,%u,%u,%u,%u\r\n", b->name, (unsigned)b->ops,
+                (unsigned)cycles, (unsigned)us, (unsigned)st.pixels, (unsigned)st.bytes,
+                (unsigned)st.commands, (unsigned)pps, (unsigned)bps);
+}
+
+int main(void) {
+    ST7789_Init();              // also starts the DWT cycle counter
+    Bench_BuildData();
+
+    ST7789_FillScreen(ST7789_COLOR_BLACK);
+    mini_printf("BENCH_BEGIN,hclk=%u\r\n", (unsigned)SystemCoreClock);
+    for(uint8_t i = 0; i < sizeof(benches) / sizeof(benches[0]); i++) Bench_Run(&benches[i]);
+    mini_printf("BENCH_END\r\n");
+
+#ifdef DISPLAY_MODEL
+    return 0;                   // host model: exit so the log can be captured
+#else
+    while(1);
+#endif
+}
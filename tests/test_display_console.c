@@ -0,0 +1,46 @@
+#include "stm32f103xb.h"
+#include "display_st7789.h"
+#include "display_console.h"
+#include "utility.h"   // for mini_printf
+#include <stdint.h>
+
+void delay(volatile uint32_t count) {
+    while(count--) __NOP();
+}
+
+int main(void) {
+    ST7789_Init();
+    ST7789_FillScreen(ST7789_COLOR_BLACK);
+
+    mini_printf("=== Console Test Started ===\r\n");
+
+    // Fixed title bar (16 rows), everything below scrolls in hardware
+    ST7789_FillRect(0, 0, ST7789_WIDTH, 16, ST7789_COLOR_BLUE);
+    ST7789_DrawString(4, 4, "SCROLL CONSOLE", ST7789_COLOR_WHITE, ST7789_COLOR_BLUE);
+    CONSOLE_Init(16, ST7789_COLOR_GREEN, ST7789_COLOR_BLACK);
+
+    // Every new line past the bottom costs one VSCSAD write + one text row
+    for (uint32_t line = 0; line < 100; line++) {
+        if (line % 10 == 0) CONSOLE_SetColor(ST7789_COLOR_YELLOW, ST7789_COLOR_BLACK);
+        CONSOLE_printf("line %u: sensor=%d\n", line, (int)(line * 7 % 113));
+        if (line % 10 == 0) CONSOLE_SetColor(ST7789_COLOR_GREEN, ST7789_COLOR_BLACK);
+        delay(20000);
+    }
+
+    // Long text wraps at 40 columns; '\r' rewrites the current row in place
+    CONSOLE_Write("This line is longer than forty characters and wraps onto the next row.\n");
+    for (uint8_t pct = 0; pct <= 100; pct += 10) {
+        CONSOLE_printf("\rprogress %u%%", pct);
+        delay(50000);
+    }
+    CONSOLE_Write("\n");
+
+    CONSOLE_Clear();
+    CONSOLE_Write("cleared\n");
+
+    mini_printf("=== Console Test Finished ===\r\n");
+
+    while(1) {
+        __NOP();
+    }
+}
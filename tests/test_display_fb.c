@@ -0,0 +1,81 @@
+#include "stm32f103xb.h"
+#include "display_st7789.h"
+#include "display_fb.h"
+#include "utility.h"   // for mini_printf
+#include <stdint.h>
+
+// 16-colour UI palette (panel colours are inverted, see ST7789_COLOR_*)
+enum { C_BLACK, C_WHITE, C_RED, C_GREEN, C_BLUE, C_YELLOW, C_CYAN, C_MAGENTA, C_GREY };
+
+static const uint16_t ui_palette[16] = {
+    ST7789_COLOR_BLACK, ST7789_COLOR_WHITE, ST7789_COLOR_RED, ST7789_COLOR_GREEN,
+    ST7789_COLOR_BLUE, ST7789_COLOR_YELLOW, ST7789_COLOR_CYAN, ST7789_COLOR_MAGENTA,
+    (uint16_t)~0x8410,                                  // grey
+};
+
+// Same indices, "night mode" colours
+static const uint16_t night_palette[16] = {
+    ST7789_COLOR_BLACK, ST7789_COLOR_RED, ST7789_COLOR_RED, ST7789_COLOR_RED,
+    ST7789_COLOR_BLACK, ST7789_COLOR_RED, ST7789_COLOR_RED, ST7789_COLOR_RED,
+    ST7789_COLOR_BLACK,
+};
+
+void delay(volatile uint32_t count) {
+    while(count--) __NOP();
+}
+
+int main(void) {
+    ST7789_Init();
+    ST7789_FillScreen(ST7789_COLOR_BLACK);
+
+    mini_printf("=== Palette Framebuffer Test Started ===\r\n");
+
+    // -------------------- 1) Compose a panel off-screen --------------------
+    // 240x80 at 4 bpp = 9600 bytes of RAM; nothing reaches the panel until FB_Flush
+    mini_printf("1) Off-screen compose\r\n");
+    if(FB_Init(0, 80, 240, 80, 4, ui_palette) != FB_OK) mini_printf("FB_Init failed\r\n");
+
+    FB_FillRect(0, 0, 240, 16, C_BLUE);
+    FB_DrawString(4, 4, "STATUS", C_WHITE, FB_TRANSPARENT);
+    FB_DrawHLine(0, 16, 240, C_GREY);
+    for(uint8_t i = 0; i < 6; i++) FB_FillRect(10 + i * 38, 30, 30, 40, C_RED + i);
+    FB_Flush();                                         // one window, one burst
+    delay(500000);
+
+    // -------------------- 2) Flicker-free value updates --------------------
+    // Each frame erases and redraws the text in RAM; only those rows are sent
+    mini_printf("2) Counter redraw\r\n");
+    for(uint8_t counter = 0; counter < 50; counter++) {
+        char text[] = "COUNT 00";
+        text[6] = '0' + counter / 10;
+        text[7] = '0' + counter % 10;
+
+        FB_FillRect(150, 4, 60, 8, C_BLUE);
+        FB_DrawString(150, 4, text, C_YELLOW, FB_TRANSPARENT);
+        FB_Flush();
+        delay(20000);
+    }
+
+    // -------------------- 3) Palette swap --------------------
+    // New colours without touching the pixels: the whole area is resent
+    mini_printf("3) Palette swap\r\n");
+    FB_SetPalette(night_palette);
+    FB_Flush();
+    delay(500000);
+    FB_SetPalette(ui_palette);
+    FB_Flush();
+
+    // -------------------- 4) 8 bpp window --------------------
+    mini_printf("4) 8 bpp gradient\r\n");
+    static uint16_t ramp[256];
+    for(uint16_t i = 0; i < 256; i++) ramp[i] = ~(uint16_t)(((i >> 3) << 11) | ((i >> 2) << 5));
+    if(FB_Init(56, 170, 128, 64, 8, ramp) != FB_OK) mini_printf("FB_Init failed\r\n");
+    for(uint8_t x = 0; x < 128; x++) FB_DrawVLine(x, 0, 64, x * 2);
+    FB_Flush();
+
+    mini_printf("=== Palette Framebuffer Test Finished ===\r\n");
+
+    while(1) {
+        __NOP();
+    }
+}
@@ -0,0 +1,48 @@
+#include "stm32f103xb.h"
+#include "display_st7789.h"
+#include "display_font.h"
+#include "utility.h"   // for mini_printf, mini_snprintf
+#include <stdint.h>
+
+// ----------------- Fonts -----------------
+// Generated into src/ (Lato and Source Code Pro, SIL OFL 1.1):
+//   python tools/fontconv.py Lato-Regular.ttf font_sans16 --size 16 --bpp 4 > src/font_sans16.c
+//   python tools/fontconv.py SourceCodePro-Bold.ttf font_digits40 --size 40 --bpp 2 --chars "0123456789.:- " > src/font_digits40.c
+extern const FONT_t font_sans16;
+extern const FONT_t font_digits40;
+
+void delay(volatile uint32_t count) {
+    while(count--) __NOP();
+}
+
+int main(void) {
+    ST7789_Init();
+    ST7789_FillScreen(ST7789_COLOR_BLACK);
+
+    mini_printf("=== Font Test Started ===\r\n");
+
+    // Lowercase now exists in the built-in 5x7 font too
+    ST7789_DrawString(0, 0, "5x7: abcdefghijklmnopqrstuvwxyz {|}~", ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
+
+    // Proportional, anti-aliased text: one address window per line
+    FONT_DrawString(0, 16, "Proportional text,\nanti-aliased edges.", &font_sans16,
+                    ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
+    FONT_DrawString(0, 56, "On a coloured background", &font_sans16,
+                    ST7789_COLOR_YELLOW, ST7789_COLOR_BLUE);
+
+    // Large numerics, centred, redrawn in place
+    char buf[16];
+    for (uint16_t i = 0; i <= 500; i += 7) {
+        mini_snprintf(buf, sizeof(buf), " %u.%u ", i / 10, i % 10);
+        uint16_t w = FONT_TextWidth(&font_digits40, buf);
+        FONT_DrawString((ST7789_WIDTH - w) / 2, 120, buf, &font_digits40,
+                        ST7789_COLOR_GREEN, ST7789_COLOR_BLACK);
+        delay(50000);
+    }
+
+    mini_printf("=== Font Test Finished ===\r\n");
+
+    while(1) {
+        __NOP();
+    }
+}
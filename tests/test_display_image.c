@@ -0,0 +1,67 @@
+#include "stm32f103xb.h"
+#include "display_st7789.h"
+#include "utility.h"   // for mini_printf
+#include <stdint.h>
+
+// ----------------- Image -----------------
+// 24x24 red disc with a white ring, generated with:
+//   python tools/img2rle.py disc.ppm icon_disc
+static const uint16_t icon_disc_data[162] = {
+    0x8037,0xFFFF,0x8007,0x0000,0x800D,0xFFFF,0x800B,0x0000,0x800A,0xFFFF,0x8003,0x0000,
+    0x8005,0x07FF,0x8003,0x0000,0x8008,0xFFFF,0x8002,0x0000,0x8009,0x07FF,0x8002,0x0000,
+    0x8006,0xFFFF,0x8002,0x0000,0x800B,0x07FF,0x8002,0x0000,0x8005,0xFFFF,0x0001,0x0000,
+    0x0000,0x800D,0x07FF,0x0001,0x0000,0x0000,0x8004,0xFFFF,0x8002,0x0000,0x800D,0x07FF,
+    0x8002,0x0000,0x8003,0xFFFF,0x0001,0x0000,0x0000,0x800F,0x07FF,0x0001,0x0000,0x0000,
+    0x8003,0xFFFF,0x0001,0x0000,0x0000,0x800F,0x07FF,0x0001,0x0000,0x0000,0x8003,0xFFFF,
+    0x0001,0x0000,0x0000,0x800F,0x07FF,0x0001,0x0000,0x0000,0x8003,0xFFFF,0x0001,0x0000,
+    0x0000,0x800F,0x07FF,0x0001,0x0000,0x0000,0x8003,0xFFFF,0x0001,0x0000,0x0000,0x800F,
+    0x07FF,0x0001,0x0000,0x0000,0x8003,0xFFFF,0x0001,0x0000,0x0000,0x800F,0x07FF,0x0001,
+    0x0000,0x0000,0x8003,0xFFFF,0x8002,0x0000,0x800D,0x07FF,0x8002,0x0000,0x8004,0xFFFF,
+    0x0001,0x0000,0x0000,0x800D,0x07FF,0x0001,0x0000,0x0000,0x8005,0xFFFF,0x8002,0x0000,
+    0x800B,0x07FF,0x8002,0x0000,0x8006,0xFFFF,0x8002,0x0000,0x8009,0x07FF,0x8002,0x0000,
+    0x8008,0xFFFF,0x8003,0x0000,0x8005,0x07FF,0x8003,0x0000,0x800A,0xFFFF,0x800B,0x0000,
+    0x800D,0xFFFF,0x8007,0x0000,0x8037,0xFFFF,
+};
+
+static const ST7789_Image_t icon_disc = {
+    .width = 24, .height = 24,
+    .data = icon_disc_data, .length = 162
+};
+
+void delay(volatile uint32_t count) {
+    while(count--) __NOP();
+}
+
+int main(void) {
+    ST7789_Init();
+    ST7789_FillScreen(ST7789_COLOR_BLUE);
+
+    mini_printf("=== Image Test Started ===\r\n");
+
+    // One address window per image; long runs become DMA fills
+    for (uint16_t y = 0; y < ST7789_HEIGHT; y += 30) {
+        for (uint16_t x = 0; x < ST7789_WIDTH; x += 30) {
+            ST7789_DrawImage(x, y, &icon_disc);
+        }
+    }
+    delay(500000);
+
+    // Clipped at the right and bottom edges
+    ST7789_FillScreen(ST7789_COLOR_BLACK);
+    ST7789_DrawImage(228, 100, &icon_disc);
+    ST7789_DrawImage(100, 228, &icon_disc);
+    ST7789_DrawImage(230, 230, &icon_disc);
+
+    // Moving icon: redraw in place several times per second
+    for (uint16_t x = 0; x < ST7789_WIDTH - 24; x += 2) {
+        ST7789_FillRect(x ? x - 2 : 0, 40, 2, 24, ST7789_COLOR_BLACK);
+        ST7789_DrawImage(x, 40, &icon_disc);
+        delay(20000);
+    }
+
+    mini_printf("=== Image Test Finished ===\r\n");
+
+    while(1) {
+        __NOP();
+    }
+}
@@ -0,0 +1,45 @@
+#include "stm32f103xb.h"
+#include "display_st7789.h"
+#include "display_render.h"
+#include "utility.h"   // for mini_printf
+#include <stdint.h>
+
+void delay(volatile uint32_t count) {
+    while(count--) __NOP();
+}
+
+int main(void) {
+    ST7789_Init();
+    ST7789_FillScreen(ST7789_COLOR_BLACK);
+
+    mini_printf("=== Band Renderer Test Started ===\r\n");
+
+    // -------------------- 1) Overlapping draws, one push --------------------
+    // Background bar then two text layers on top: composed in RAM per band,
+    // sent with one address window per band instead of three full redraws.
+    mini_printf("1) Overlapping draws\r\n");
+    RENDER_FillRect(0, 40, ST7789_WIDTH, 40, ST7789_COLOR_BLUE);
+    RENDER_DrawStringScaled(10, 48, "JAI SREE RAM", ST7789_COLOR_WHITE, ST7789_COLOR_BLUE, 2);
+    RENDER_DrawStringScaled(10, 48, "JAI", ST7789_COLOR_YELLOW, ST7789_COLOR_BLUE, 2);
+    RENDER_Flush();
+    delay(500000);
+
+    // -------------------- 2) Background-then-foreground rewrite --------------------
+    mini_printf("2) Dynamic value redraw\r\n");
+    for (uint8_t counter = 1; counter < 6; counter++) {
+        char text[] = "0: OM NAMAH SHIVAIAH";
+        text[0] = '0' + counter;
+
+        RENDER_FillRect(10, 120, 220, 16, ST7789_COLOR_BLACK);
+        RENDER_DrawStringScaled(10, 120, text, ST7789_COLOR_CYAN, ST7789_COLOR_BLACK, 2);
+        RENDER_DrawStringScaled(10, 120, text, ST7789_COLOR_YELLOW, ST7789_COLOR_GREEN, 2);
+        RENDER_Flush();
+        delay(100000);
+    }
+
+    mini_printf("=== Band Renderer Test Finished ===\r\n");
+
+    while(1) {
+        __NOP();
+    }
+}
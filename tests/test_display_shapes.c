@@ -0,0 +1,58 @@
+#include "stm32f103xb.h"
+#include "display_st7789.h"
+#include "utility.h"   // for mini_printf
+#include <stdint.h>
+
+void delay(volatile uint32_t count) {
+    while(count--) __NOP();
+}
+
+// Needle end points for a 0..180 degree gauge, radius 80 (sin * 80, 10-degree steps)
+static const int8_t needle_dy[19] = {0,14,27,40,51,61,69,75,79,80,79,75,69,61,51,40,27,14,0};
+
+int main(void) {
+    ST7789_Init();
+    ST7789_FillScreen(ST7789_COLOR_BLACK);
+
+    mini_printf("=== Shapes Test Started ===\r\n");
+
+    // Spans: one address window each
+    ST7789_DrawHLine(0, 5, ST7789_WIDTH, ST7789_COLOR_WHITE);
+    ST7789_DrawVLine(5, 0, ST7789_HEIGHT, ST7789_COLOR_WHITE);
+
+    // Outlines and fills, partly off-screen to exercise clipping
+    ST7789_DrawCircle(40, 40, 30, ST7789_COLOR_GREEN);
+    ST7789_FillCircle(120, 40, 30, ST7789_COLOR_RED);
+    ST7789_DrawCircle(235, 40, 30, ST7789_COLOR_YELLOW);
+    ST7789_DrawRoundRect(10, 80, 100, 50, 12, ST7789_COLOR_CYAN);
+    ST7789_FillRoundRect(130, 80, 100, 50, 12, ST7789_COLOR_BLUE);
+    ST7789_DrawTriangle(20, 230, 60, 150, 100, 230, ST7789_COLOR_MAGENTA);
+    ST7789_FillTriangle(130, 230, 170, 150, 250, 200, ST7789_COLOR_GREEN);
+    delay(1000000);
+
+    // Gauge: sweep a needle by redrawing the previous one in the background colour
+    ST7789_FillScreen(ST7789_COLOR_BLACK);
+    ST7789_DrawCircle(120, 160, 90, ST7789_COLOR_WHITE);
+    ST7789_FillCircle(120, 160, 6, ST7789_COLOR_RED);
+
+    int16_t prev_x = 40, prev_y = 160;
+    for (uint8_t pass = 0; pass < 4; pass++) {
+        for (uint8_t i = 0; i < 19; i++) {
+            uint8_t step = (pass & 1) ? 18 - i : i;
+            int16_t dx = (step <= 9) ? -needle_dy[9 - step] : needle_dy[step - 9];
+            int16_t x = 120 + dx;
+            int16_t y = 160 - needle_dy[step];
+
+            ST7789_DrawLine(120, 160, prev_x, prev_y, ST7789_COLOR_BLACK);
+            ST7789_DrawLine(120, 160, x, y, ST7789_COLOR_YELLOW);
+            prev_x = x; prev_y = y;
+            delay(30000);
+        }
+    }
+
+    mini_printf("=== Shapes Test Finished ===\r\n");
+
+    while(1) {
+        __NOP();
+    }
+}
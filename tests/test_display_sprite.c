@@ -0,0 +1,66 @@
+#include "stm32f103xb.h"
+#include "display_st7789.h"
+#include "utility.h"   // for mini_printf
+#include <stdint.h>
+
+// ----------------- Sprites -----------------
+// 8x8 1-bit arrow, two frames (up / down); index 0 is transparent
+static const uint8_t arrow_up[8]   = {0x18,0x3C,0x7E,0xFF,0x18,0x18,0x18,0x18};
+static const uint8_t arrow_down[8] = {0x18,0x18,0x18,0x18,0xFF,0x7E,0x3C,0x18};
+static const uint16_t arrow_palette[2] = {ST7789_COLOR_BLACK, ST7789_COLOR_GREEN};
+
+static const ST7789_Sprite_t arrow_frames[2] = {
+    { .width = 8, .height = 8, .bpp = 1, .flags = ST7789_SPRITE_KEYED, .key = 0,
+      .pixels = arrow_up, .palette = arrow_palette },
+    { .width = 8, .height = 8, .bpp = 1, .flags = ST7789_SPRITE_KEYED, .key = 0,
+      .pixels = arrow_down, .palette = arrow_palette },
+};
+
+// 16x16 RGB565 ball built at start-up; corners use the key colour
+#define BALL_KEY  0x1234
+static uint16_t ball_pixels[16 * 16];
+static const ST7789_Sprite_t ball = {
+    .width = 16, .height = 16, .bpp = 16, .flags = ST7789_SPRITE_KEYED, .key = BALL_KEY,
+    .pixels = ball_pixels
+};
+
+void delay(volatile uint32_t count) {
+    while(count--) __NOP();
+}
+
+int main(void) {
+    ST7789_Init();
+    ST7789_FillScreen(ST7789_COLOR_BLACK);
+
+    mini_printf("=== Sprite Test Started ===\r\n");
+
+    for (int16_t r = 0; r < 16; r++) {
+        for (int16_t c = 0; c < 16; c++) {
+            int16_t dx = 2 * c - 15, dy = 2 * r - 15;
+            ball_pixels[r * 16 + c] = (dx * dx + dy * dy < 225) ? ST7789_COLOR_RED : BALL_KEY;
+        }
+    }
+
+    // Striped background so transparency is visible
+    for (uint16_t y = 0; y < ST7789_HEIGHT; y += 20)
+        ST7789_FillRect(0, y, ST7789_WIDTH, 10, ST7789_COLOR_BLUE);
+
+    // Clipping: partly off every edge
+    ST7789_DrawSprite(-8, 100, &ball);
+    ST7789_DrawSprite(232, 100, &ball);
+    ST7789_DrawSprite(100, -8, &ball);
+    ST7789_DrawSprite(100, 232, &ball);
+
+    // Animated status icon: alternate frames several times per second
+    for (uint16_t i = 0; i < 40; i++) {
+        ST7789_FillRect(200, 10, 8, 8, ST7789_COLOR_BLACK);  // restore background
+        ST7789_DrawSprite(200, 10, &arrow_frames[i & 1]);
+        delay(100000);
+    }
+
+    mini_printf("=== Sprite Test Finished ===\r\n");
+
+    while(1) {
+        __NOP();
+    }
+}
@@ -21,9 +21,11 @@ void delay(volatile uint32_t count) {
     while(count--) __NOP();
 }
 
+static volatile uint8_t fill_done = 0;
+static void FillDone_Callback(void) { fill_done = 1; }
+
 int main(void) {
     // Initialize SPI2 and display
-    SPI2_GPIO_Init();
     ST7789_Init();
 
     mini_printf("=== ST7789 API Test Started ===\r\n");
@@ -41,6 +43,13 @@ int main(void) {
     ST7789_FillScreen(ST7789_COLOR_BLUE);
     delay(500000);
 
+    mini_printf("1) Async Fill Screen Test: BLACK\r\n");
+    uint32_t spins = 0;
+    ST7789_FillScreenAsync(ST7789_COLOR_BLACK, FillDone_Callback);
+    while(!fill_done) spins++;   // CPU is free while DMA streams the pixels
+    mini_printf("Async fill done, main loop spun %u times\r\n", spins);
+    delay(500000);
+
     // -------------------- 2) Draw Pixel Test --------------------
     mini_printf("2) Draw Pixel Test\r\n");
     ST7789_FillScreen(ST7789_COLOR_BLACK);
@@ -50,6 +59,16 @@ int main(void) {
     ST7789_DrawPixel(150, 150, ST7789_COLOR_BLUE);
     delay(500000);
 
+    // -------------------- 2b) Scanline Push Test --------------------
+    mini_printf("2b) Scanline Push Test\r\n");
+    static uint16_t line[ST7789_MAX_SIDE];
+    for(uint16_t x=0; x<ST7789_WIDTH; x++)
+        line[x] = (uint16_t)(((x >> 3) << 11) | ((x >> 2) << 5) | (x >> 3)); // grey ramp
+    ST7789_SetAddressWindow(0, 200, ST7789_WIDTH - 1, 239);
+    for(uint16_t y=200; y<240; y++)
+        ST7789_WritePixels(line, ST7789_WIDTH);
+    delay(500000);
+
     // -------------------- 3) Fill Rectangle Test --------------------
     mini_printf("3) Fill Rectangle Test\r\n");
     ST7789_FillRect(20, 20, 50, 30, ST7789_COLOR_YELLOW);
@@ -78,6 +97,22 @@ int main(void) {
             for(volatile int i=0; i<100000; i++); // simple delay
          }
 
+    // -------------------- 6) Rotation / Mirror Test --------------------
+    mini_printf("6) Rotation / Mirror Test\r\n");
+    for(uint8_t rot=ST7789_ROTATION_0; rot<=ST7789_ROTATION_270; rot++)
+    {
+        ST7789_SetRotation(rot, 0);
+        ST7789_FillScreen(ST7789_COLOR_BLACK);
+        ST7789_FillRect(0, 0, 20, 20, ST7789_COLOR_RED);           // marks logical (0,0)
+        ST7789_DrawStringScaled(30, 5, "TOP LEFT", ST7789_COLOR_WHITE, ST7789_COLOR_BLACK, 2);
+        mini_printf("rotation %d: %dx%d\r\n", rot, ST7789_WIDTH, ST7789_HEIGHT);
+        delay(500000);
+    }
+    ST7789_SetRotation(ST7789_ROTATION_0, ST7789_MIRROR_X);
+    ST7789_DrawStringScaled(30, 40, "MIRRORED", ST7789_COLOR_YELLOW, ST7789_COLOR_BLACK, 2);
+    delay(500000);
+    ST7789_SetRotation(ST7789_ROTATION_0, 0);
+
     mini_printf("=== ST7789 API Test Finished ===\r\n");
 
     while(1) {
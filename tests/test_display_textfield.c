@@ -0,0 +1,44 @@
+#include "stm32f103xb.h"
+#include "display_st7789.h"
+#include "display_textfield.h"
+#include "utility.h"   // for mini_printf
+#include <stdint.h>
+
+void delay(volatile uint32_t count) {
+    while(count--) __NOP();
+}
+
+int main(void) {
+    ST7789_Init();
+    ST7789_FillScreen(ST7789_COLOR_BLACK);
+
+    mini_printf("=== Text Field Test Started ===\r\n");
+
+    TEXTFIELD_t counter_field;
+    TEXTFIELD_t status_field;
+    TEXTFIELD_Init(&counter_field, 10, 50, 3);
+    TEXTFIELD_Init(&status_field, 10, 120, 2);
+
+    // Only the digits that change are redrawn; the "COUNT:" label stays put
+    for (uint32_t counter = 0; counter < 200; counter++) {
+        TEXTFIELD_printf(&counter_field, ST7789_COLOR_WHITE, ST7789_COLOR_BLACK, "COUNT:%u", counter);
+
+        // Same text, new colours → every cell repaints once, then nothing
+        if (counter % 50 == 0)
+            TEXTFIELD_Set(&status_field, (counter % 100) ? "STATE: RUN" : "STATE: IDLE",
+                          ST7789_COLOR_YELLOW, ST7789_COLOR_BLACK);
+
+        delay(20000);
+    }
+
+    // After a full-screen clear the cache no longer matches the panel
+    ST7789_FillScreen(ST7789_COLOR_BLACK);
+    TEXTFIELD_Invalidate(&counter_field);
+    TEXTFIELD_printf(&counter_field, ST7789_COLOR_GREEN, ST7789_COLOR_BLACK, "DONE");
+
+    mini_printf("=== Text Field Test Finished ===\r\n");
+
+    while(1) {
+        __NOP();
+    }
+}
@@ -2,7 +2,7 @@
 #include "uart.h"
 #include "i2c.h"
 #include "eeprom.h"
-#include <stdio.h>
+#include "utility.h"
 
 #define TEST_MEM_ADDR 0x0000
 #define TEST_STR_LEN  7
@@ -46,7 +46,7 @@ int main(void) {
 
     uint8_t byte = 0;
     EEPROM_ReadByte(I2C1, TEST_MEM_ADDR, &byte);
-    sprintf(buf, "Read byte: %c (0x%02X)\r\n", byte, byte);
+    mini_snprintf(buf, sizeof(buf), "Read byte: %c (0x%02X)\r\n", byte, byte);
     UART_WriteString(USART2, buf);
 
     // -----------------------------
@@ -54,7 +54,7 @@ int main(void) {
     // -----------------------------
     UART_WriteString(USART2, "Testing multi-byte write...\r\n");
     for(int i=0;i<TEST_STR_LEN;i++){
-        sprintf(buf, "Writing byte '%c'...\r\n", write_data[i]);
+        mini_snprintf(buf, sizeof(buf), "Writing byte '%c'...\r\n", write_data[i]);
         UART_WriteString(USART2, buf);
     }
 
@@ -69,7 +69,7 @@ int main(void) {
 
     UART_WriteString(USART2, "Read data: ");
     for(int i=0;i<TEST_STR_LEN;i++){
-        sprintf(buf, "%c", read_data[i]);
+        mini_snprintf(buf, sizeof(buf), "%c", read_data[i]);
         UART_WriteString(USART2, buf);
     }
     UART_WriteString(USART2, "\r\n");
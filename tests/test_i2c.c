@@ -1,6 +1,7 @@
 #include "stm32f103xb.h"
 #include "i2c.h"
 #include "uart.h"
+#include "utility.h"
 
 #define EEPROM_ADDR    0x50       // 24C256 base I2C address
 #define TEST_MEM_ADDR  0x0000     // Starting memory address in EEPROM
@@ -64,7 +65,7 @@ int main(void) {
     I2C_Stop(I2C1);
 
     char buf[50];
-    sprintf(buf, "Read byte: 0x%02X\r\n", byte);
+    mini_snprintf(buf, sizeof(buf), "Read byte: 0x%02X\r\n", byte);
     UART_WriteString(USART2, buf);
 
     // -----------------------------
@@ -77,7 +78,7 @@ int main(void) {
     I2C_Write(I2C1, TEST_MEM_ADDR & 0xFF);        // low byte
 
     for(int i=0;i<TEST_STR_LEN;i++) {
-        sprintf(buf, "Writing byte '%c'...\r\n", write_data[i]);
+        mini_snprintf(buf, sizeof(buf), "Writing byte '%c'...\r\n", write_data[i]);
         UART_WriteString(USART2, buf);
         I2C_Write(I2C1, write_data[i]);
     }
@@ -108,7 +109,7 @@ int main(void) {
 
     UART_WriteString(USART2, "Read data: ");
     for(int i=0;i<TEST_STR_LEN;i++) {
-        sprintf(buf, "%c", read_data[i]);
+        mini_snprintf(buf, sizeof(buf), "%c", read_data[i]);
         UART_WriteString(USART2, buf);
     }
     UART_WriteString(USART2, "\r\n");
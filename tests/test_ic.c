@@ -3,7 +3,6 @@
 #include "uart.h"
 #include "gpio.h"
 #include "rcc.h"
-#include <stdio.h>
 #include "utility.h"
 
 // ------------------------ Global variables ------------------------
@@ -93,7 +92,7 @@ int main(void) {
     uint16_t duty_cycle = 500;
 
     while (1) {
-        snprintf(buf, sizeof(buf), "Freq: %.1f Hz, Duty: %.1f %%\r\n", pwm_frequency, pwm_duty);
+        mini_snprintf(buf, sizeof(buf), "Freq: %.1f Hz, Duty: %.1f %%\r\n", pwm_frequency, pwm_duty);
         UART_WriteString(USART2, buf);
 
         for (volatile int i=0; i<500000; i++); // simple delay
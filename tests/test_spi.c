@@ -1,21 +1,21 @@
 #include "stm32f103xb.h"
 #include "spi.h"
 #include "uart.h"
-#include <stdio.h>
+#include "utility.h"
 
-// ----------------- CS Pin -----------------
-#define CS_PORT GPIOA
-#define CS_PIN  4
-
-void CS_Init(void) {
-    RCC->APB2ENR |= RCC_APB2ENR_IOPAEN; // Enable GPIOA clock
-    GPIOA->CRL &= ~(0xF << (CS_PIN*4)); // Clear config
-    GPIOA->CRL |= 0x3 << (CS_PIN*4);    // Output push-pull 10MHz
-    GPIOA->BSRR = (1 << CS_PIN);        // idle high
-}
-
-void CS_LOW(void)  { GPIOA->BSRR = (1 << (CS_PIN + 16)); }
-void CS_HIGH(void) { GPIOA->BSRR = (1 << CS_PIN); }
+// ----------------- Device -----------------
+// ADXL345-style sensor on SPI1: 1 MHz max, mode 3, CS on PA4
+SPI_Handle_t sensor_spi = {
+    .SPIx   = SPI1,
+    .config = {
+        .maxClock = 1000000,
+        .mode     = SPI_MODE_3,
+        .bitOrder = SPI_MSB_FIRST,
+        .dataSize = SPI_DATASIZE_8BIT
+    },
+    .csPort = GPIOA,
+    .csPin  = 4
+};
 
 void delay(volatile uint32_t t) { while(t--); }
 
@@ -32,28 +32,30 @@ int main(void) {
     UART_Init(USART2, &uart2_cfg);
     UART_WriteString(USART2, "USART2 SPI Test Ready!\r\n");
 
-    // ----------------- SPI Init -----------------
-    SPI1_GPIO_Init();
-    SPI1_Init();
-
-    // ----------------- CS Init -----------------
-    CS_Init();
+    // ----------------- SPI Init (pins, clock, CS) -----------------
+    SPI_Init(&sensor_spi);
 
     char buf[50];
+    mini_snprintf(buf, sizeof(buf), "SPI1 SCK = %lu Hz\r\n", (unsigned long)SPI_GetClock(&sensor_spi));
+    UART_WriteString(USART2, buf);
+
     uint8_t txData[] = {0xAA, 0x55, 0xFF, 0x00}; // Test pattern
     uint8_t rx;
 
     while(1) {
         for(uint8_t i=0; i<sizeof(txData); i++) {
-            CS_LOW();
+            SPI_Begin(&sensor_spi);        // apply config, CS low
             delay(1000); // tiny delay
 
-            rx = SPI1_Transmit(txData[i]); // send byte
+            uint8_t status = SPI_TransmitReceive(&sensor_spi, txData[i], &rx); // send byte
 
             delay(1000);
-            CS_HIGH();
+            SPI_End(&sensor_spi);          // wait idle, CS high
 
-            sprintf(buf, "CS toggle -> Sent: 0x%02X, Received: 0x%02X\r\n", txData[i], rx);
+            if(status == SPI_TIMEOUT)
+                mini_snprintf(buf, sizeof(buf), "CS toggle -> Sent: 0x%02X, TIMEOUT\r\n", txData[i]);
+            else
+                mini_snprintf(buf, sizeof(buf), "CS toggle -> Sent: 0x%02X, Received: 0x%02X\r\n", txData[i], rx);
             UART_WriteString(USART2, buf);
 
             delay(500000); // slow down loop for logic analyzer
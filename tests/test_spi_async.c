@@ -0,0 +1,79 @@
+#include "stm32f103xb.h"
+#include "spi.h"
+#include "uart.h"
+#include "adc.h"
+#include "utility.h"
+
+// ----------------- Devices -----------------
+// Sensor on SPI1 (CS PA4) and a write-only device on the same bus (CS PB0)
+SPI_Handle_t sensor_spi = {
+    .SPIx   = SPI1,
+    .config = { .maxClock = 1000000, .mode = SPI_MODE_3 },
+    .csPort = GPIOA,
+    .csPin  = 4
+};
+
+SPI_Handle_t dac_spi = {
+    .SPIx   = SPI1,
+    .config = { .maxClock = 0, .mode = SPI_MODE_0 },
+    .csPort = GPIOB,
+    .csPin  = 0
+};
+
+// ----------------- Transactions -----------------
+static uint8_t sensor_cmd[7] = {0xF2};        // read 6 data registers (multi-byte)
+static uint8_t sensor_rx[7];
+static uint8_t dac_block[64];
+
+static volatile uint32_t sensor_done = 0;
+static volatile uint32_t dac_done = 0;
+
+static void Sensor_Callback(SPI_Transaction_t *t) { (void)t; sensor_done++; }
+static void Dac_Callback(SPI_Transaction_t *t)    { (void)t; dac_done++; }
+
+SPI_Transaction_t sensor_xfer = {
+    .hspi = &sensor_spi, .txBuf = sensor_cmd, .rxBuf = sensor_rx, .len = sizeof(sensor_cmd),
+    .preDelayUs = 5, .postDelayUs = 5, .callback = Sensor_Callback
+};
+
+SPI_Transaction_t dac_xfer = {
+    .hspi = &dac_spi, .txBuf = dac_block, .rxBuf = 0, .len = sizeof(dac_block),   // DMA path
+    .callback = Dac_Callback
+};
+
+int main(void) {
+    UART_Config_t uart2_cfg = {
+        .baudRate   = 115200,
+        .wordLength = UART_WORDLENGTH_8B,
+        .stopBits   = UART_STOPBITS_1,
+        .parity     = UART_PARITY_NONE,
+        .enableTx   = 1,
+        .enableRx   = 0
+    };
+    UART_Init(USART2, &uart2_cfg);
+    UART_WriteString(USART2, "SPI async queue test\r\n");
+
+    SPI_Init(&sensor_spi);
+    SPI_Init(&dac_spi);
+    ADC_Init();
+
+    for (uint8_t i = 0; i < sizeof(dac_block); i++) dac_block[i] = i;
+
+    char buf[80];
+    uint32_t loops = 0;
+
+    while (1) {
+        // Re-queue each transaction once the previous run has finished
+        if (sensor_xfer.status != SPI_PENDING) SPI_Queue(&sensor_xfer);
+        if (dac_xfer.status != SPI_PENDING)    SPI_Queue(&dac_xfer);
+
+        // Main loop keeps working while the bus runs from interrupts
+        uint16_t adc = ADC_Read_Single(ADC_CHANNEL_0);
+        if (++loops % 20000 == 0) {
+            mini_snprintf(buf, sizeof(buf), "ADC=%u sensor=%lu dac=%lu X=%d\r\n", adc,
+                    (unsigned long)sensor_done, (unsigned long)dac_done,
+                    (int16_t)(sensor_rx[1] | (sensor_rx[2] << 8)));
+            UART_WriteString(USART2, buf);
+        }
+    }
+}
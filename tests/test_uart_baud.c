@@ -0,0 +1,113 @@
+#include "stm32f103xb.h"
+#include "uart.h"
+#include "rcc.h"
+#include "utility.h"
+
+// Baud generation from the live clock tree. USART3 (not wired) is used to
+// compute BRR and the rate error for a list of rates; results go out on
+// USART2. After switching to the 72 MHz PLL, USART1 runs a 2 Mbaud and a
+// 4.5 Mbaud loopback: jumper PA9 (TX) to PA10 (RX).
+
+static const uint32_t rates[] = {9600, 115200, 460800, 921600, 1000000, 2000000, 2250000, 4500000};
+
+static uint8_t pattern[1024];
+static uint8_t rx_buf[2048];
+
+static void Console_Init(void) {
+    UART_Config_t cfg = {
+        .baudRate   = 115200,
+        .wordLength = UART_WORDLENGTH_8B,
+        .stopBits   = UART_STOPBITS_1,
+        .parity     = UART_PARITY_NONE,
+        .enableTx   = 1,
+        .enableRx   = 0
+    };
+    UART_Init(USART2, &cfg);
+}
+
+static void Print(const char *s) {
+    UART_WriteString(USART2, s);
+}
+
+// BRR and error of every rate on 'USARTx' at the current clock
+static void Table(USART_TypeDef *USARTx, const char *name) {
+    UART_Config_t cfg = { .wordLength = UART_WORDLENGTH_8B, .stopBits = UART_STOPBITS_1,
+                          .parity = UART_PARITY_NONE, .enableTx = 1 };
+    char buf[80];
+
+    mini_snprintf(buf, sizeof(buf), "%s, PCLK1 %lu Hz, PCLK2 %lu Hz\r\n", name,
+            (unsigned long)RCC_GetPCLK1Freq(), (unsigned long)RCC_GetPCLK2Freq());
+    Print(buf);
+    for (uint8_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+        cfg.baudRate = rates[i];
+        UART_Init(USARTx, &cfg);
+        mini_snprintf(buf, sizeof(buf), "  %8lu: BRR 0x%04lx, actual %8lu, error %6ld ppm\r\n", (unsigned long)rates[i],
+                (unsigned long)USARTx->BRR, (unsigned long)UART_GetBaudRate(USARTx),
+                (long)UART_GetBaudError(USARTx));
+        Print(buf);
+    }
+}
+
+// USART1 TX → RX through the jumper: DMA both ways, compare what came back
+static void Loopback(uint32_t baud) {
+    UART_Config_t cfg = {
+        .baudRate   = baud,
+        .wordLength = UART_WORDLENGTH_8B,
+        .stopBits   = UART_STOPBITS_1,
+        .parity     = UART_PARITY_NONE,
+        .enableTx   = 1,
+        .enableRx   = 1,
+        .txDma      = 1
+    };
+    UART_Init(USART1, &cfg);
+    UART_StartRxDMA(USART1, rx_buf, sizeof(rx_buf), 0);
+
+    UART_TxSegment_t seg = { .data = pattern, .len = sizeof(pattern) };
+    UART_WriteAsync(USART1, &seg);
+    UART_Flush(USART1);
+    for (volatile uint32_t d = 0; d < 10000; d++);      // last byte + IDLE
+
+    uint32_t got = 0, errors = 0;
+    const uint8_t *data;
+    uint16_t len;
+    while ((len = UART_ReadSpan(USART1, &data)) != 0) {
+        for (uint16_t i = 0; i < len; i++, got++) {
+            if (got >= sizeof(pattern) || data[i] != pattern[got]) errors++;
+        }
+    }
+    UART_StopRxDMA(USART1);
+
+    char buf[80];
+    mini_snprintf(buf, sizeof(buf), "  %lu baud: %lu/%u bytes back, %lu wrong, error %ld ppm\r\n", (unsigned long)baud,
+            (unsigned long)got, (unsigned)sizeof(pattern), (unsigned long)errors,
+            (long)UART_GetBaudError(USART1));
+    Print(buf);
+}
+
+int main(void) {
+    for (uint16_t i = 0; i < sizeof(pattern); i++) pattern[i] = (uint8_t)(i * 7 + (i >> 8));
+
+    // -------------------- 1) Reset clock: 8 MHz HSI --------------------
+    Console_Init();
+    Print("\r\n=== UART baud test ===\r\n");
+    Table(USART3, "1) HSI 8 MHz, USART3");
+
+    // -------------------- 2) PLL: HSE (ST-LINK MCO) x9, else HSI/2 x16 --------------------
+    // Every USART divider depends on the clock: flush, switch, init again
+    UART_Flush(USART2);
+    uint8_t hse = RCC_SetSysClockPLL(RCC_PLL_HSE_BYPASS) == RCC_OK;
+    if (!hse) RCC_SetSysClockPLL(RCC_PLL_HSI);
+    Console_Init();
+    Print(hse ? "2) PLL from HSE, 72 MHz\r\n" : "2) No HSE: PLL from HSI, 64 MHz\r\n");
+    Table(USART3, "   USART3 (APB1)");
+    Table(USART1, "   USART1 (APB2)");
+
+    // -------------------- 3) High-speed loopback on USART1 --------------------
+    Print("3) USART1 loopback, PA9 -> PA10\r\n");
+    Loopback(2000000);
+    Loopback(hse ? 4500000 : 4000000);
+
+    while (1) {
+        __NOP();
+    }
+}
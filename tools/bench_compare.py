@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""
+bench_compare.py - compare two display benchmark logs (tests/test_display_bench.c).
+
+Usage:
+    python tools/bench_compare.py before.log after.log
+    python tools/bench_compare.py after.log                 # just tabulate
+
+Logs are UART captures or `make bench-host` output; only BENCH lines are read:
+    BENCH,name,ops,cycles,us,pixels,bytes,commands,pixels_per_s,bytes_per_s
+Cycle counts are compared, so logs taken at different clocks still line up
+as long as the SPI divider is the same. Exit status is 1 if any workload got
+more than --threshold percent slower.
+"""
+
+import argparse
+import sys
+
+FIELDS = ["ops", "cycles", "us", "pixels", "bytes", "commands", "pps", "bps"]
+
+
+def load(path):
+    rows = {}
+    with open(path, errors="replace") as f:
+        for line in f:
+            parts = line.strip().split(",")
+            if len(parts) != 10 or parts[0] != "BENCH":
+                continue
+            rows[parts[1]] = dict(zip(FIELDS, map(int, parts[2:])))
+    if not rows:
+        sys.exit("%s: no BENCH lines" % path)
+    return rows
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("before")
+    ap.add_argument("after", nargs="?")
+    ap.add_argument("--threshold", type=float, default=5.0, help="slowdown %% that counts as a regression")
+    args = ap.parse_args()
+
+    before = load(args.before)
+    if not args.after:
+        print("%-14s %12s %10s %10s %9s" % ("workload", "cycles", "cyc/op", "bytes", "cmds"))
+        for name, r in before.items():
+            print("%-14s %12d %10d %10d %9d" % (name, r["cycles"], r["cycles"] // max(r["ops"], 1),
+                                                r["bytes"], r["commands"]))
+        return 0
+
+    after = load(args.after)
+    worse = 0
+    print("%-14s %12s %12s %8s %10s %10s" % ("workload", "before", "after", "change", "bytes", "cmds"))
+    for name, a in after.items():
+        b = before.get(name)
+        if not b:
+            print("%-14s %12s %12d %8s" % (name, "-", a["cycles"], "new"))
+            continue
+        change = 100.0 * (a["cycles"] - b["cycles"]) / max(b["cycles"], 1)
+        flag = ""
+        if change > args.threshold:
+            flag = "  <-- slower"
+            worse += 1
+        print("%-14s %12d %12d %+7.1f%% %+10d %+10d%s" % (name, b["cycles"], a["cycles"], change,
+                                                          a["bytes"] - b["bytes"],
+                                                          a["commands"] - b["commands"], flag))
+    return 1 if worse else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
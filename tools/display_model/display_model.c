@@ -0,0 +1,183 @@
+// Host-side model of SPI2 + ST7789 for the display benchmark.
+//
+// Build and run from the project root:   make bench-host
+//
+// The real display driver is compiled against this file instead of spi.c,
+// dwt.c and the hardware. Every byte is decoded like the panel would
+// (CASET/RASET/RAMWR/RAMWRC) into a 240x320 frame memory, and a cycle
+// counter advances by the time the transfer would take on the bus:
+//   - 8 SCK periods per byte, SCK = HCLK / MODEL_SPI_DIV
+//   - a fixed CPU cost per driver→SPI call (polling, DC/CS changes, DMA setup)
+// CPU time spent composing pixels between transfers is not modelled, so the
+// numbers are bus-bound estimates meant for comparing commits.
+//
+// Environment:
+//   DISPLAY_MODEL_HCLK=72000000   core clock (default 8 MHz HSI, like the board)
+//   DISPLAY_MODEL_SPI_DIV=2       HCLK cycles per SCK (default 2: APB1 = HCLK, fPCLK/2)
+//   DISPLAY_MODEL_DUMP=out.ppm    write the visible frame memory at exit
+
+#include "stm32f103xb.h"
+#include "spi.h"
+#include "dwt.h"
+#include "utility.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// --- Cost model (HCLK cycles) ---
+#define MODEL_CALL_CYCLES   20    // blocking transfer call: BSY wait, DR access
+#define MODEL_DMA_CYCLES    250   // DMA fill: channel setup + completion IRQ
+#define MODEL_MEM_COLS      240
+#define MODEL_MEM_ROWS      320
+
+GPIO_TypeDef model_gpiob;
+SPI_TypeDef  model_spi2;
+RCC_TypeDef  model_rcc;
+uint32_t SystemCoreClock = 8000000;
+
+static uint64_t model_cycles;
+static uint32_t model_spi_div = 2;
+
+// --- Panel state ---
+static uint16_t frame[MODEL_MEM_ROWS][MODEL_MEM_COLS];
+static uint8_t dc;                         // 1 = data
+static uint8_t cmd;
+static uint8_t params[4];
+static uint8_t nparams;
+static uint16_t xs, xe = MODEL_MEM_COLS - 1, ys, ye = MODEL_MEM_ROWS - 1;
+static uint16_t px, py;
+static uint8_t writing;
+static uint8_t pixel_hi, pixel_half;
+
+static void Model_SampleDC(void) {
+    uint32_t bsrr = model_gpiob.BSRR;
+    if(bsrr & GPIO_BSRR_BS11) dc = 1;
+    if(bsrr & GPIO_BSRR_BR11) dc = 0;
+    model_gpiob.BSRR = 0;
+}
+
+static void Model_Pixel(uint16_t color) {
+    if(px < MODEL_MEM_COLS && py < MODEL_MEM_ROWS) frame[py][px] = color;
+    if(++px > xe) {
+        px = xs;
+        if(++py > ye) py = ys;
+    }
+}
+
+static void Model_Byte(uint8_t b) {
+    model_cycles += 8 * model_spi_div;
+
+    if(!dc) {
+        cmd = b;
+        nparams = 0;
+        pixel_half = 0;
+        writing = (b == 0x2C || b == 0x3C);
+        if(b == 0x2C) { px = xs; py = ys; }  // RAMWR restarts at the window origin
+        return;
+    }
+
+    if(writing) {
+        if(!pixel_half) { pixel_hi = b; pixel_half = 1; }
+        else { pixel_half = 0; Model_Pixel((pixel_hi << 8) | b); }
+        return;
+    }
+
+    if(nparams < 4) params[nparams++] = b;
+    if(nparams == 4 && cmd == 0x2A) { xs = (params[0] << 8) | params[1]; xe = (params[2] << 8) | params[3]; }
+    if(nparams == 4 && cmd == 0x2B) { ys = (params[0] << 8) | params[1]; ye = (params[2] << 8) | params[3]; }
+}
+
+static void Model_Dump(void) {
+    const char *path = getenv("DISPLAY_MODEL_DUMP");
+    if(!path) return;
+    FILE *f = fopen(path, "wb");
+    if(!f) return;
+
+    // Visible area, colours un-inverted like the panel shows them
+    fprintf(f, "P6\n%d %d\n255\n", MODEL_MEM_COLS, 240);
+    for(int y = 0; y < 240; y++) {
+        for(int x = 0; x < MODEL_MEM_COLS; x++) {
+            uint16_t c = ~frame[y][x];
+            uint8_t rgb[3] = {(c >> 8) & 0xF8, (c >> 3) & 0xFC, (c << 3) & 0xF8};
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+    fclose(f);
+}
+
+static void Model_Setup(void) {
+    static uint8_t done = 0;
+    if(done) return;
+    done = 1;
+
+    const char *hclk = getenv("DISPLAY_MODEL_HCLK");
+    const char *div = getenv("DISPLAY_MODEL_SPI_DIV");
+    if(hclk) SystemCoreClock = (uint32_t)strtoul(hclk, 0, 0);
+    if(div) model_spi_div = (uint32_t)strtoul(div, 0, 0);
+    if(model_spi_div < 2) model_spi_div = 2;
+    atexit(Model_Dump);
+}
+
+// ------------------- SPI -------------------
+
+void SPI_Init(SPI_Handle_t *hspi) { (void)hspi; Model_Setup(); }
+uint32_t SPI_GetClock(SPI_Handle_t *hspi) { (void)hspi; return SystemCoreClock / model_spi_div; }
+
+uint8_t SPI_Transmit(SPI_Handle_t *hspi, uint8_t data) {
+    (void)hspi;
+    Model_SampleDC();
+    model_cycles += MODEL_CALL_CYCLES;
+    Model_Byte(data);
+    return SPI_OK;
+}
+
+uint8_t SPI_Write(SPI_Handle_t *hspi, const uint8_t *txBuf, uint32_t len) {
+    (void)hspi;
+    Model_SampleDC();
+    model_cycles += MODEL_CALL_CYCLES;
+    while(len--) Model_Byte(*txBuf++);
+    return SPI_OK;
+}
+
+void SPI_SetDataSize(SPI_Handle_t *hspi, SPI_DataSize_t size) { (void)hspi; (void)size; model_cycles += 4; }
+
+uint8_t SPI_TransmitBuffer16(SPI_Handle_t *hspi, const uint16_t *txBuf, uint32_t len) {
+    (void)hspi;
+    Model_SampleDC();
+    model_cycles += MODEL_CALL_CYCLES;
+    while(len--) { Model_Byte(*txBuf >> 8); Model_Byte(*txBuf & 0xFF); txBuf++; }
+    return SPI_OK;
+}
+
+// Fills complete immediately; the callback still runs once
+uint8_t SPI_FillDMA(SPI_Handle_t *hspi, uint16_t value, uint32_t count, SPI_Callback_t callback) {
+    (void)hspi;
+    Model_SampleDC();
+    model_cycles += MODEL_DMA_CYCLES;
+    while(count--) { Model_Byte(value >> 8); Model_Byte(value & 0xFF); }
+    if(callback) callback();
+    return SPI_OK;
+}
+
+uint8_t SPI_IsBusy(SPI_Handle_t *hspi) { (void)hspi; return 0; }
+void SPI_Claim(SPI_Handle_t *hspi) { (void)hspi; }
+void SPI_Release(SPI_Handle_t *hspi) { (void)hspi; }
+
+// ------------------- DWT -------------------
+// The cycle counter is the model's bus clock; delays only advance it.
+
+void SystemCoreClockUpdate(void) {}
+void DWT_Init(void) { Model_Setup(); }
+uint32_t DWT_GetCycles(void) { return (uint32_t)model_cycles; }
+uint32_t DWT_CyclesToUs(uint32_t cycles) { return cycles / (SystemCoreClock / 1000000U); }
+void DWT_DelayUs(uint32_t us) { model_cycles += (uint64_t)us * (SystemCoreClock / 1000000U); }
+void DWT_DelayMs(uint32_t ms) { DWT_DelayUs(ms * 1000); }
+
+// ------------------- Output -------------------
+
+void mini_printf(const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+}
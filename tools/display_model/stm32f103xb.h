@@ -0,0 +1,34 @@
+// Host stand-in for the CMSIS device header: just the registers and types
+// the display driver touches. Peripherals are plain structs in display_model.c.
+// Uses the real header's guard, so include/spi.h and include/dwt.h (which
+// include the real header from their own directory) pick this one up instead.
+// Every host source must include it before spi.h / dwt.h.
+#ifndef __STM32F103xB_H
+#define __STM32F103xB_H
+
+#include <stdint.h>
+
+typedef struct { volatile uint32_t CRL, CRH, IDR, ODR, BSRR, BRR, LCKR; } GPIO_TypeDef;
+typedef struct { volatile uint32_t CR1, CR2, SR, DR; } SPI_TypeDef;
+typedef struct { volatile uint32_t APB2ENR, APB1ENR; } RCC_TypeDef;
+
+extern GPIO_TypeDef model_gpiob;
+extern SPI_TypeDef  model_spi2;
+extern RCC_TypeDef  model_rcc;
+
+#define GPIOB  (&model_gpiob)
+#define SPI2   (&model_spi2)
+#define RCC    (&model_rcc)
+
+#define RCC_APB2ENR_IOPBEN  (1UL << 3)
+#define GPIO_BSRR_BS11      (1UL << 11)
+#define GPIO_BSRR_BS12      (1UL << 12)
+#define GPIO_BSRR_BR11      (1UL << 27)
+#define GPIO_BSRR_BR12      (1UL << 28)
+
+#define __NOP()  ((void)0)
+
+extern uint32_t SystemCoreClock;
+void SystemCoreClockUpdate(void);
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef _UTILITY_H
+#define _UTILITY_H
+
+// Host stand-in: mini_printf goes to stdout instead of USART2
+#include <stdint.h>
+
+void mini_printf(const char *fmt, ...);
+
+#endif
@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+"""
+fontconv.py - compile a TTF/OTF or BDF font into a packed FONT_t for display_font.c.
+
+Usage:
+    python tools/fontconv.py DejaVuSans.ttf font_sans16 --size 16 --bpp 4  > src/font_sans16.c
+    python tools/fontconv.py Roboto.ttf font_digits32 --size 32 --chars "0123456789.:-" > src/font_digits32.c
+    python tools/fontconv.py ter-u16n.bdf font_term16 > src/font_term16.c
+
+TTF/OTF needs freetype-py (pip install freetype-py); BDF is parsed directly
+and is always 1 bpp.
+
+Output layout (see include/display_font.h):
+  - one FONT_Glyph_t per code in [first, last]; codes not requested get an
+    empty entry, so lookup is a single subtraction
+  - glyph boxes are trimmed to their ink, and pixels are packed MSB first
+    with no per-row padding, bpp bits each (1 = mono, 2/4 = alpha levels)
+"""
+
+import argparse
+import sys
+
+
+class Glyph:
+    def __init__(self, code, width, height, x_off, y_off, advance, pixels):
+        self.code = code
+        self.width = width        # box size in pixels
+        self.height = height
+        self.x_off = x_off        # box left, relative to the pen position
+        self.y_off = y_off        # box top, relative to the baseline (negative = up)
+        self.advance = advance
+        self.pixels = pixels      # rows of alpha values 0..255
+
+    def trim(self):
+        rows = self.pixels
+        while rows and not any(rows[0]):
+            rows = rows[1:]
+            self.y_off += 1
+        while rows and not any(rows[-1]):
+            rows = rows[:-1]
+        if not rows:
+            self.width = self.height = self.x_off = self.y_off = 0
+            self.pixels = []
+            return
+        left = min(next(i for i, v in enumerate(r) if v) for r in rows if any(r))
+        right = max(len(r) - next(i for i, v in enumerate(reversed(r)) if v) for r in rows if any(r))
+        self.pixels = [r[left:right] for r in rows]
+        self.x_off += left
+        self.width = right - left
+        self.height = len(rows)
+
+
+# ------------------------------------------------------------------ loaders
+
+def load_bdf(path, codes):
+    glyphs, ascent, descent = {}, None, None
+    with open(path, "r", encoding="latin-1") as f:
+        lines = iter(f.read().splitlines())
+
+    for line in lines:
+        key, _, rest = line.partition(" ")
+        if key == "FONT_ASCENT":
+            ascent = int(rest)
+        elif key == "FONT_DESCENT":
+            descent = int(rest)
+        elif key == "STARTCHAR":
+            code, advance, bbx, rows = None, 0, (0, 0, 0, 0), []
+            for line in lines:
+                key, _, rest = line.partition(" ")
+                if key == "ENCODING":
+                    code = int(rest.split()[0])
+                elif key == "DWIDTH":
+                    advance = int(rest.split()[0])
+                elif key == "BBX":
+                    bbx = tuple(int(v) for v in rest.split())
+                elif key == "BITMAP":
+                    for line in lines:
+                        if line.startswith("ENDCHAR"):
+                            break
+                        rows.append(line.strip())
+                    break
+
+            if code not in codes:
+                continue
+            w, h, xo, yo = bbx
+            pixels = []
+            for hexrow in rows[:h]:
+                bits = bin(int(hexrow, 16))[2:].zfill(len(hexrow) * 4)
+                pixels.append([255 if b == "1" else 0 for b in bits[:w]])
+            glyphs[code] = Glyph(code, w, h, xo, -(yo + h), advance, pixels)
+
+    if ascent is None or descent is None:
+        sys.exit("error: BDF has no FONT_ASCENT/FONT_DESCENT")
+    return glyphs, ascent, ascent + descent
+
+
+def load_ttf(path, codes, size, bpp):
+    try:
+        import freetype
+    except ImportError:
+        sys.exit("error: TTF/OTF input needs freetype-py (pip install freetype-py)")
+
+    face = freetype.Face(path)
+    face.set_pixel_sizes(0, size)
+    flags = freetype.FT_LOAD_RENDER
+    if bpp == 1:
+        flags |= freetype.FT_LOAD_TARGET_MONO
+
+    glyphs = {}
+    for code in codes:
+        if face.get_char_index(code) == 0:
+            continue
+        face.load_char(chr(code), flags)
+        g = face.glyph
+        bm = g.bitmap
+        pixels = []
+        for y in range(bm.rows):
+            row = bm.buffer[y * bm.pitch:(y + 1) * bm.pitch]
+            if bpp == 1:
+                pixels.append([255 if (row[x >> 3] >> (7 - (x & 7))) & 1 else 0 for x in range(bm.width)])
+            else:
+                pixels.append(list(row[:bm.width]))
+        glyphs[code] = Glyph(code, bm.width, bm.rows, g.bitmap_left, -g.bitmap_top,
+                             (g.advance.x + 32) >> 6, pixels)
+
+    ascent = (face.size.ascender + 63) >> 6
+    height = (face.size.height + 63) >> 6
+    return glyphs, ascent, height
+
+
+# ------------------------------------------------------------------ output
+
+def pack(glyph, bpp):
+    """Pixels of one glyph packed MSB first, bpp bits each, rounded alpha."""
+    out, acc, nbits = [], 0, 0
+    levels = (1 << bpp) - 1
+    for row in glyph.pixels:
+        for v in row:
+            acc = (acc << bpp) | ((v * levels + 127) // 255)
+            nbits += bpp
+            if nbits == 8:
+                out.append(acc)
+                acc, nbits = 0, 0
+    if nbits:
+        out.append(acc << (8 - nbits))
+    return out
+
+
+def main():
+    ap = argparse.ArgumentParser(description="TTF/BDF -> packed FONT_t C source")
+    ap.add_argument("font")
+    ap.add_argument("name", help="C identifier of the FONT_t")
+    ap.add_argument("--size", type=int, default=16, help="pixel height for TTF/OTF")
+    ap.add_argument("--bpp", type=int, choices=(1, 2, 4), default=1, help="bits per pixel (2/4 = anti-aliased)")
+    ap.add_argument("--first", type=int, default=32)
+    ap.add_argument("--last", type=int, default=126)
+    ap.add_argument("--chars", help="only these characters (first/last follow from them)")
+    args = ap.parse_args()
+
+    if args.chars:
+        codes = sorted(set(ord(c) for c in args.chars))
+    else:
+        codes = list(range(args.first, args.last + 1))
+    if codes[0] < 0 or codes[-1] > 255:
+        sys.exit("error: codes must be in 0..255")
+
+    if args.font.lower().endswith(".bdf"):
+        if args.bpp != 1:
+            print("note: BDF fonts are bitmaps, using --bpp 1", file=sys.stderr)
+            args.bpp = 1
+        glyphs, ascent, height = load_bdf(args.font, set(codes))
+    else:
+        glyphs, ascent, height = load_ttf(args.font, codes, args.size, args.bpp)
+
+    first, last = codes[0], codes[-1]
+    bitmap, table = [], []
+    for code in range(first, last + 1):
+        g = glyphs.get(code)
+        if g is None:
+            table.append((0, 0, 0, 0, 0, 0, "missing"))
+            continue
+        g.trim()
+        for field in (g.width, g.height, g.advance):
+            if field > 255:
+                sys.exit("error: glyph %r too large" % chr(code))
+        if len(bitmap) > 0xFFFF:
+            sys.exit("error: bitmap exceeds 64 KB, use fewer characters or a smaller size")
+        table.append((len(bitmap), g.width, g.height, g.x_off, g.y_off, g.advance, repr(chr(code))))
+        bitmap.extend(pack(g, args.bpp))
+
+    print("// Generated by tools/fontconv.py from %s" % args.font)
+    print("// %u px line, %u bpp, codes %u..%u, %u bytes of bitmap"
+          % (height, args.bpp, first, last, len(bitmap)))
+    print('#include "display_font.h"')
+    print()
+    print("static const uint8_t %s_bitmap[%u] = {" % (args.name, max(len(bitmap), 1)))
+    for i in range(0, max(len(bitmap), 1), 16):
+        print("    " + ",".join("0x%02X" % b for b in (bitmap[i:i + 16] or [0])) + ",")
+    print("};")
+    print()
+    print("static const FONT_Glyph_t %s_glyphs[%u] = {" % (args.name, len(table)))
+    for off, w, h, xo, yo, adv, label in table:
+        print("    {%5u, %3u, %3u, %4d, %4d, %3u}, // %s" % (off, w, h, xo, yo, adv, label))
+    print("};")
+    print()
+    print("const FONT_t %s = {" % args.name)
+    print("    .bitmap = %s_bitmap, .glyphs = %s_glyphs," % (args.name, args.name))
+    print("    .first = %u, .last = %u, .height = %u, .baseline = %u, .bpp = %u"
+          % (first, last, height, ascent, args.bpp))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""
+img2rle.py - convert an image into an RLE RGB565 C array for ST7789_DrawImage.
+
+Usage:
+    python tools/img2rle.py splash.png splash          > src/splash.c
+    python tools/img2rle.py icon.ppm icon --no-invert  > icon.c
+
+Any format Pillow can open is accepted; binary PPM (P6) works without Pillow.
+
+Output: a const uint16_t token stream plus a const ST7789_Image_t, both in
+flash. Stream format (see display_st7789.h):
+    0x8000 | (n-1), color       -> n copies of color   (n <= 32768)
+    (n-1), c0 .. c(n-1)         -> n literal pixels
+Runs shorter than --min-run stay inside literal blocks, since a run token
+costs two words.
+
+The panel on this board shows inverted colours (see ST7789_COLOR_*), so
+pixels are inverted by default; pass --no-invert for a normal panel.
+"""
+
+import argparse
+import sys
+
+MAX_COUNT = 0x8000
+
+
+def load_ppm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    # Header: magic, width, height, maxval separated by whitespace/comments
+    fields, pos = [], 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos) + 1
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        fields.append(data[start:pos])
+    pos += 1
+
+    if fields[0] != b"P6" or int(fields[3]) != 255:
+        sys.exit("error: only 8-bit binary PPM (P6) is supported without Pillow")
+
+    w, h = int(fields[1]), int(fields[2])
+    raw = data[pos:pos + w * h * 3]
+    return w, h, [tuple(raw[i:i + 3]) for i in range(0, len(raw), 3)]
+
+
+def load_image(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        return load_ppm(path)
+
+    img = Image.open(path).convert("RGB")
+    return img.width, img.height, list(img.getdata())
+
+
+def rgb565(r, g, b, invert):
+    c = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+    return (~c & 0xFFFF) if invert else c
+
+
+def encode(pixels, min_run):
+    """Return the token stream for a flat list of RGB565 pixels."""
+    out, literal = [], []
+
+    def flush_literal():
+        while literal:
+            block = literal[:MAX_COUNT]
+            del literal[:MAX_COUNT]
+            out.append(len(block) - 1)
+            out.extend(block)
+
+    i = 0
+    while i < len(pixels):
+        j = i + 1
+        while j < len(pixels) and pixels[j] == pixels[i] and j - i < MAX_COUNT:
+            j += 1
+
+        if j - i >= min_run:
+            flush_literal()
+            out.append(0x8000 | (j - i - 1))
+            out.append(pixels[i])
+        else:
+            literal.extend(pixels[i:j])
+        i = j
+
+    flush_literal()
+    return out
+
+
+def decode(tokens):
+    """Reference decoder, used to check the encoder output."""
+    px, i = [], 0
+    while i < len(tokens):
+        n = (tokens[i] & 0x7FFF) + 1
+        if tokens[i] & 0x8000:
+            px.extend([tokens[i + 1]] * n)
+            i += 2
+        else:
+            px.extend(tokens[i + 1:i + 1 + n])
+            i += 1 + n
+    return px
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Image -> RLE RGB565 C array")
+    ap.add_argument("image")
+    ap.add_argument("name", help="C identifier of the ST7789_Image_t")
+    ap.add_argument("--no-invert", action="store_true", help="panel without colour inversion")
+    ap.add_argument("--min-run", type=int, default=3, help="shortest run encoded as a run token")
+    args = ap.parse_args()
+
+    w, h, rgb = load_image(args.image)
+    if w > 0xFFFF or h > 0xFFFF:
+        sys.exit("error: image too large")
+
+    pixels = [rgb565(r, g, b, not args.no_invert) for (r, g, b) in rgb]
+    tokens = encode(pixels, max(args.min_run, 2))
+    assert decode(tokens) == pixels
+
+    raw = w * h * 2
+    packed = len(tokens) * 2
+    print("// Generated by tools/img2rle.py from %s" % args.image)
+    print("// %ux%u, %u bytes (raw %u bytes, %.1f%%)" % (w, h, packed, raw, 100.0 * packed / raw))
+    print('#include "display_st7789.h"')
+    print()
+    print("static const uint16_t %s_data[%u] = {" % (args.name, len(tokens)))
+    for i in range(0, len(tokens), 12):
+        print("    " + ",".join("0x%04X" % t for t in tokens[i:i + 12]) + ",")
+    print("};")
+    print()
+    print("const ST7789_Image_t %s = {" % args.name)
+    print("    .width = %u, .height = %u," % (w, h))
+    print("    .data = %s_data, .length = %u" % (args.name, len(tokens)))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
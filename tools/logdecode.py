@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+"""
+logdecode.py - turn LOG() frames (include/log.h) back into text.
+
+Usage:
+    python tools/logdecode.py build/main.elf capture.bin
+    python tools/logdecode.py build/main.elf --port COM5 --baud 115200
+    python tools/logdecode.py build/main.elf --list      # show the format table
+
+The format strings are read from the .logstr section of the ELF that is
+running on the board; a frame's ID is the offset of its string there.
+Frames on the wire:
+    0x7E, nargs, id_lo, id_hi, nargs x 4-byte LE words, sum(bytes after 0x7E) & 0xFF
+Bytes that do not form a valid frame (e.g. mini_printf text on the same
+UART) are passed through unchanged. %s arguments are addresses of constant
+strings; they are looked up in the ELF's loaded sections. Serial input
+needs pyserial (pip install pyserial).
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+SYNC = 0x7E
+ID_DROPPED = 0xFFFF
+MAX_ARGS = 8
+
+SPEC = re.compile(r"%([-+ 0#]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l)?([diuxXcsfp%])")
+
+
+class Elf:
+    """Just enough ELF32/ELF64 (little endian) to read sections by name and address."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        d = self.data
+        if d[:4] != b"\x7fELF" or d[5] != 1:
+            sys.exit("%s: not a little-endian ELF file" % path)
+        is64 = d[4] == 2
+        if is64:
+            shoff, = struct.unpack_from("<Q", d, 0x28)
+            shentsize, shnum, shstrndx = struct.unpack_from("<HHH", d, 0x3A)
+            fmt = "<IIQQQQIIQQ"
+        else:
+            shoff, = struct.unpack_from("<I", d, 0x20)
+            shentsize, shnum, shstrndx = struct.unpack_from("<HHH", d, 0x2E)
+            fmt = "<IIIIIIIIII"
+
+        raw = [struct.unpack_from(fmt, d, shoff + i * shentsize) for i in range(shnum)]
+        names = raw[shstrndx][4]
+        self.sections = []
+        for name, stype, flags, addr, offset, size in (r[:6] for r in raw):
+            end = d.index(b"\0", names + name)
+            self.sections.append({
+                "name": d[names + name:end].decode(),
+                "alloc": bool(flags & 0x2) and stype != 8,      # SHF_ALLOC, not NOBITS
+                "addr": addr,
+                "data": d[offset:offset + size] if stype != 8 else b"",
+            })
+
+    def section(self, name):
+        for s in self.sections:
+            if s["name"] == name:
+                return s
+        return None
+
+    def string_at(self, addr):
+        for s in self.sections:
+            if s["alloc"] and s["addr"] <= addr < s["addr"] + len(s["data"]):
+                data = s["data"]
+                start = addr - s["addr"]
+                end = data.find(b"\0", start)
+                return data[start:end if end >= 0 else len(data)].decode(errors="replace")
+        return None
+
+
+def load_formats(elf, name):
+    sec = elf.section(name)
+    if sec is None:
+        sys.exit("no %s section: is LOG() used and the linker script up to date?" % name)
+    formats = {}
+    data = sec["data"]
+    pos = 0
+    while pos < len(data):
+        end = data.find(b"\0", pos)
+        if end < 0:
+            end = len(data)
+        if end > pos:
+            formats[pos] = data[pos:end].decode(errors="replace")
+        pos = end + 1
+    return formats
+
+
+def count_args(fmt):
+    n = 0
+    for m in SPEC.finditer(fmt):
+        if m.group(5) != "%":
+            n += 1 + (m.group(2) == "*") + (m.group(3) == "*")
+    return n
+
+
+def render(fmt, words, elf):
+    """Apply the C format to the raw 32-bit words."""
+    args = iter(words)
+
+    def one(m):
+        flags, width, prec, _, conv = m.groups()
+        if conv == "%":
+            return "%"
+        width = str(next(args, 0)) if width == "*" else (width or "")
+        prec = str(next(args, 0)) if prec == "*" else prec
+        spec = "%" + flags + width + ("." + prec if prec is not None else "")
+        w = next(args, 0)
+        if conv in "di":
+            return (spec + "d") % (w - (1 << 32) if w & 0x80000000 else w)
+        if conv in "uxX":
+            return (spec + conv) % w
+        if conv == "p":
+            return (spec + "s") % ("0x%08x" % w)
+        if conv == "c":
+            return (spec + "c") % chr(w & 0xFF)
+        if conv == "f":
+            return (spec + "f") % struct.unpack("<f", struct.pack("<I", w))[0]
+        text = elf.string_at(w)
+        return (spec + "s") % (text if text is not None else "<0x%08x>" % w)
+
+    return SPEC.sub(one, fmt)
+
+
+class Decoder:
+    def __init__(self, elf, formats, out):
+        self.elf = elf
+        self.formats = formats
+        self.out = out
+        self.buf = bytearray()
+
+    def frame_at(self, i):
+        """Length of a valid frame at buf[i], 0 if not enough bytes yet, -1 if not a frame."""
+        b = self.buf
+        if len(b) - i < 2:
+            return 0
+        nargs = b[i + 1]
+        if nargs > MAX_ARGS:
+            return -1
+        size = 5 + 4 * nargs
+        if len(b) - i < size:
+            return 0
+        if sum(b[i + 1:i + size - 1]) & 0xFF != b[i + size - 1]:
+            return -1
+        fid = b[i + 2] | b[i + 3] << 8
+        if fid == ID_DROPPED:
+            return size if nargs == 1 else -1
+        fmt = self.formats.get(fid)
+        if fmt is None or count_args(fmt) > nargs:
+            return -1
+        return size
+
+    def emit(self, i, size):
+        b = self.buf
+        nargs = b[i + 1]
+        fid = b[i + 2] | b[i + 3] << 8
+        words = struct.unpack_from("<%dI" % nargs, b, i + 4)
+        if fid == ID_DROPPED:
+            line = "[log] %u records dropped (ring full)" % words[0]
+        else:
+            line = render(self.formats[fid], words, self.elf)
+        self.out.write(line if line.endswith("\n") else line + "\n")
+
+    def feed(self, data, final=False):
+        self.buf += data
+        i = 0
+        text = bytearray()
+        while i < len(self.buf):
+            if self.buf[i] == SYNC:
+                size = self.frame_at(i)
+                if size == 0 and not final:
+                    break
+                if size > 0:
+                    if text:
+                        self.out.write(text.decode(errors="replace"))
+                        text.clear()
+                    self.emit(i, size)
+                    i += size
+                    continue
+            text.append(self.buf[i])
+            i += 1
+        if text:
+            self.out.write(text.decode(errors="replace"))
+        del self.buf[:i]
+        self.out.flush()
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("elf", help="the firmware image running on the board (build/main.elf)")
+    ap.add_argument("capture", nargs="?", help="raw UART capture; stdin if omitted and no --port")
+    ap.add_argument("--port", help="read from a serial port instead (needs pyserial)")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--section", default=".logstr")
+    ap.add_argument("--list", action="store_true", help="print ID, argument count and format, then exit")
+    args = ap.parse_args()
+
+    elf = Elf(args.elf)
+    formats = load_formats(elf, args.section)
+    if args.list:
+        for fid, fmt in sorted(formats.items()):
+            print("%5d %d %r" % (fid, count_args(fmt), fmt))
+        return 0
+
+    dec = Decoder(elf, formats, sys.stdout)
+    if args.port:
+        try:
+            import serial
+        except ImportError:
+            sys.exit("error: --port needs pyserial (pip install pyserial)")
+        with serial.Serial(args.port, args.baud, timeout=0.1) as port:
+            try:
+                while True:
+                    dec.feed(port.read(4096))
+            except KeyboardInterrupt:
+                pass
+    else:
+        stream = open(args.capture, "rb") if args.capture else sys.stdin.buffer
+        with stream:
+            while True:
+                chunk = stream.read(4096)
+                if not chunk:
+                    break
+                dec.feed(chunk)
+    dec.feed(b"", final=True)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())